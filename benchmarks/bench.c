@@ -2,11 +2,16 @@
 #include "hive_ipc.h"
 #include "hive_pool.h"
 #include "hive_bus.h"
+#include "hive_group.h"
+#include "hive_timer.h"
 #include "hive_static_config.h"
+#include "hive_internal.h"
+#include "hive_timer_wheel.h"
 #include <stdio.h>
 #include <stdlib.h>
 #include <time.h>
 #include <string.h>
+#include <sys/time.h>
 
 // Timing utilities
 #define BILLION 1000000000UL
@@ -236,6 +241,88 @@ static void bench_ipc_copy(size_t msg_size, const char *label) {
     free(ctx_recv);
 }
 
+// Send cost when the receiver is blocked on a multi-filter receive: every
+// enqueue runs the wakeup check against all of the receiver's filters
+#define FILTER_COUNT 8
+#define FILTER_BATCH 16
+#define FILTER_TAG_BASE 100
+#define FILTER_TAG_NOISE 1
+
+static void filter_receiver(void *args, const hive_spawn_info *siblings,
+                            size_t sibling_count) {
+    (void)siblings;
+    (void)sibling_count;
+    ipc_ctx *ctx = (ipc_ctx *)args;
+    uint8_t ack = 1;
+
+    hive_recv_filter filters[FILTER_COUNT];
+    for (int i = 0; i < FILTER_COUNT; i++) {
+        filters[i] = (hive_recv_filter){ctx->partner, HIVE_MSG_NOTIFY,
+                                        FILTER_TAG_BASE + i};
+    }
+
+    for (uint64_t i = 0; i < ctx->max_count; i++) {
+        // Blocks until the last filter matches; the noise stays queued
+        hive_message msg;
+        hive_ipc_recv_matches(filters, FILTER_COUNT, &msg, -1, NULL);
+        while (HIVE_SUCCEEDED(hive_ipc_recv(&msg, 0))) {
+        }
+
+        hive_ipc_notify(ctx->partner, 0, &ack, sizeof(ack));
+    }
+
+    hive_exit();
+}
+
+static void filter_sender(void *args, const hive_spawn_info *siblings,
+                          size_t sibling_count) {
+    (void)siblings;
+    (void)sibling_count;
+    ipc_ctx *ctx = (ipc_ctx *)args;
+    uint8_t buffer[8] = {0};
+
+    for (uint64_t i = 0; i < ctx->max_count; i++) {
+        // Receiver stays blocked: only these sends are timed
+        uint64_t t0 = get_nanos();
+        for (int j = 0; j < FILTER_BATCH; j++) {
+            hive_ipc_notify(ctx->partner, FILTER_TAG_NOISE, buffer,
+                            sizeof(buffer));
+        }
+        ctx->end_time += get_nanos() - t0;
+
+        hive_ipc_notify(ctx->partner, FILTER_TAG_BASE + FILTER_COUNT - 1,
+                        buffer, sizeof(buffer));
+        hive_message ack;
+        hive_ipc_recv(&ack, -1);
+    }
+
+    hive_exit();
+}
+
+static void bench_ipc_filtered(void) {
+    ipc_ctx *ctx_send = calloc(1, sizeof(ipc_ctx));
+    ipc_ctx *ctx_recv = calloc(1, sizeof(ipc_ctx));
+    uint64_t rounds = ITERATIONS / FILTER_BATCH;
+    ctx_send->max_count = rounds;
+    ctx_recv->max_count = rounds;
+
+    actor_id recv;
+    actor_id send;
+    hive_spawn(filter_receiver, NULL, ctx_recv, NULL, &recv);
+    hive_spawn(filter_sender, NULL, ctx_send, NULL, &send);
+    ctx_send->partner = recv;
+    ctx_recv->partner = send;
+
+    hive_run();
+
+    uint64_t sends = rounds * FILTER_BATCH;
+    printf("  %-20s %6lu ns/send (receiver blocked on %d filters)\n",
+           "8 bytes filtered:", ctx_send->end_time / sends, FILTER_COUNT);
+
+    free(ctx_send);
+    free(ctx_recv);
+}
+
 static void bench_ipc(void) __attribute__((unused));
 static void bench_ipc(void) {
     printf("IPC Performance\n");
@@ -247,6 +334,7 @@ static void bench_ipc(void) {
     bench_ipc_copy(8, "8 bytes:");
     bench_ipc_copy(64, "64 bytes:");
     bench_ipc_copy(252, "252 bytes (max):");
+    bench_ipc_filtered();
 
     printf("\n");
 }
@@ -431,123 +519,2546 @@ static void bus_subscriber(void *args, const hive_spawn_info *siblings,
     hive_exit();
 }
 
-static void bench_bus(void) __attribute__((unused));
-static void bench_bus(void) {
-    printf("Bus Performance\n");
-    printf("---------------\n");
+// Read cost against ring depth. Keep-until-evicted (the telemetry case):
+// each round publishes half a ring, evicting entries the subscriber already
+// read, then times the subscriber reading the new half while the older half
+// stays retained.
+#define BUS_DEPTH_READS 20000
 
-    // Create bus with enough capacity for benchmark messages
-    hive_bus_config cfg = {
-        .max_entries = 64,     // Max allowed by HIVE_MAX_BUS_ENTRIES
-        .max_entry_size = 256, // Max size of each message
-        .max_subscribers = 8,
-        .consume_after_reads = 1, // Remove entries after 1 reader reads them
-        .max_age_ms = 0};
+static size_t s_bus_depth;
+static uint64_t s_bus_depth_ns;
+
+static void bus_depth_actor(void *args, const hive_spawn_info *siblings,
+                            size_t sibling_count) {
+    (void)args;
+    (void)siblings;
+    (void)sibling_count;
+    hive_bus_config cfg = {.max_entries = s_bus_depth,
+                           .max_entry_size = 64,
+                           .max_subscribers = 1,
+                           .consume_after_reads = 0,
+                           .max_age_ms = 0};
     bus_id bus;
-    hive_bus_create(&cfg, &bus);
+    s_bus_depth_ns = 0;
+    if (HIVE_FAILED(hive_bus_create(&cfg, &bus))) {
+        hive_exit();
+    }
+    hive_bus_subscribe(bus);
+
+    uint8_t data[64] = {0};
+    uint8_t buf[64];
+    size_t len;
+    size_t half = s_bus_depth / 2;
+    for (size_t i = 0; i < s_bus_depth; i++) {
+        hive_bus_publish(bus, data, sizeof(data));
+        hive_bus_read(bus, buf, sizeof(buf), &len);
+    }
 
-    // Warmup
-    bus_ctx *ctx_pub_warmup = calloc(1, sizeof(bus_ctx));
-    bus_ctx *ctx_sub_warmup = calloc(1, sizeof(bus_ctx));
+    uint64_t total = 0;
+    size_t reads = 0;
+    while (reads < BUS_DEPTH_READS) {
+        for (size_t i = 0; i < half; i++) {
+            hive_bus_publish(bus, data, sizeof(data));
+        }
+        uint64_t start = get_nanos();
+        for (size_t i = 0; i < half; i++) {
+            hive_bus_read(bus, buf, sizeof(buf), &len);
+        }
+        total += get_nanos() - start;
+        reads += half;
+    }
+    s_bus_depth_ns = total / reads;
 
-    ctx_pub_warmup->bus = bus;
-    ctx_pub_warmup->max_count = 100;
-    ctx_sub_warmup->bus = bus;
-    ctx_sub_warmup->max_count = 100;
+    hive_bus_unsubscribe(bus);
+    hive_bus_destroy(bus);
+    hive_exit();
+}
 
-    actor_id sub_warmup;
-    hive_spawn(bus_subscriber, NULL, ctx_sub_warmup, NULL, &sub_warmup);
-    actor_id pub_warmup;
-    hive_spawn(bus_publisher, NULL, ctx_pub_warmup, NULL, &pub_warmup);
-    hive_run();
+static void bench_bus_depths(void) {
+    static const size_t depths[] = {16, 64, 256, 1024, 4096};
+
+    printf("  Read latency by ring depth (full ring, half of it unread):\n");
+    for (size_t i = 0; i < sizeof(depths) / sizeof(depths[0]); i++) {
+        s_bus_depth = depths[i];
+        actor_id id;
+        hive_spawn(bus_depth_actor, NULL, NULL, NULL, &id);
+        hive_run();
+        if (s_bus_depth_ns == 0) {
+            printf("    depth %4zu: skipped (raise HIVE_MAX_BUS_ENTRIES and "
+                   "HIVE_BUS_ARENA_SIZE)\n",
+                   depths[i]);
+            continue;
+        }
+        printf("    depth %4zu: %5lu ns/read\n", depths[i], s_bus_depth_ns);
+    }
+}
 
-    free(ctx_pub_warmup);
-    free(ctx_sub_warmup);
+// Publish and read cost against subscriber count. Readers poll (read until
+// WOULDBLOCK, then yield) rather than block, so the publish figure is the
+// per-publish bookkeeping, not the wakeups themselves.
+#define BUS_FANOUT_ROUNDS 100
+#define BUS_FANOUT_BATCH 32
+
+static bus_id s_fanout_bus;
+static size_t s_fanout_subs;
+static size_t s_fanout_ready;
+static bool s_fanout_done;
+static uint64_t s_fanout_pub_ns;
+static uint64_t s_fanout_read_ns;
+static uint64_t s_fanout_reads;
+
+static void bus_fanout_reader(void *args, const hive_spawn_info *siblings,
+                              size_t sibling_count) {
+    (void)args;
+    (void)siblings;
+    (void)sibling_count;
+    hive_bus_subscribe(s_fanout_bus);
+    s_fanout_ready++;
+
+    uint8_t buf[64];
+    size_t len;
+    while (!s_fanout_done) {
+        uint64_t start = get_nanos();
+        uint64_t n = 0;
+        while (HIVE_SUCCEEDED(hive_bus_read(s_fanout_bus, buf, sizeof(buf),
+                                            &len))) {
+            n++;
+        }
+        if (n > 0) {
+            s_fanout_read_ns += get_nanos() - start;
+            s_fanout_reads += n;
+        }
+        hive_yield();
+    }
 
-    // Benchmark publish latency
-    // Use moderate iterations - publisher yields every 10 messages to cooperate
-    const uint64_t BUS_ITERATIONS = 1000;
+    hive_bus_unsubscribe(s_fanout_bus);
+    s_fanout_ready--;
+    hive_exit();
+}
 
-    bus_ctx *ctx_pub = calloc(1, sizeof(bus_ctx));
-    bus_ctx *ctx_sub = calloc(1, sizeof(bus_ctx));
+static void bus_fanout_driver(void *args, const hive_spawn_info *siblings,
+                              size_t sibling_count) {
+    (void)args;
+    (void)siblings;
+    (void)sibling_count;
+    hive_bus_config cfg = {.max_entries = 64,
+                           .max_entry_size = 64,
+                           .max_subscribers = (uint16_t)s_fanout_subs,
+                           .consume_after_reads = 0,
+                           .max_age_ms = 0};
+    hive_bus_create(&cfg, &s_fanout_bus);
+
+    actor_config acfg = HIVE_ACTOR_CONFIG_DEFAULT;
+    acfg.stack_size = 16 * 1024;
+    acfg.malloc_stack = true;
+    for (size_t i = 0; i < s_fanout_subs; i++) {
+        actor_id id;
+        hive_spawn(bus_fanout_reader, NULL, NULL, &acfg, &id);
+    }
+    while (s_fanout_ready < s_fanout_subs) {
+        hive_yield();
+    }
 
-    ctx_pub->bus = bus;
-    ctx_pub->max_count = BUS_ITERATIONS;
-    ctx_sub->bus = bus;
-    ctx_sub->max_count = BUS_ITERATIONS;
+    uint8_t data[64] = {0};
+    for (int round = 0; round < BUS_FANOUT_ROUNDS; round++) {
+        uint64_t start = get_nanos();
+        for (int i = 0; i < BUS_FANOUT_BATCH; i++) {
+            hive_bus_publish(s_fanout_bus, data, sizeof(data));
+        }
+        s_fanout_pub_ns += get_nanos() - start;
+        hive_yield(); // Every reader drains the batch
+    }
 
-    actor_id sub;
-    hive_spawn(bus_subscriber, NULL, ctx_sub, NULL, &sub);
-    actor_id pub;
-    hive_spawn(bus_publisher, NULL, ctx_pub, NULL, &pub);
-    hive_run();
+    s_fanout_done = true;
+    while (s_fanout_ready > 0) {
+        hive_yield();
+    }
+    hive_bus_destroy(s_fanout_bus);
+    hive_exit();
+}
 
-    uint64_t elapsed = ctx_pub->end_time - ctx_pub->start_time;
-    uint64_t ns_per_pub = elapsed / BUS_ITERATIONS;
-    double pubs_per_sec = (double)BUS_ITERATIONS / ((double)elapsed / BILLION);
+static void bench_bus_fanout(void) {
+    static const size_t counts[] = {1, 32, 256, 1024};
+
+    printf("  Subscriber fan-out (polling readers):\n");
+    for (size_t i = 0; i < sizeof(counts) / sizeof(counts[0]); i++) {
+        if (counts[i] > HIVE_MAX_BUS_SUBSCRIBERS ||
+            counts[i] >= HIVE_MAX_ACTORS) {
+            printf("    %4zu subscribers: skipped (raise "
+                   "HIVE_MAX_BUS_SUBSCRIBERS and HIVE_MAX_ACTORS)\n",
+                   counts[i]);
+            continue;
+        }
+        s_fanout_subs = counts[i];
+        s_fanout_ready = 0;
+        s_fanout_done = false;
+        s_fanout_pub_ns = 0;
+        s_fanout_read_ns = 0;
+        s_fanout_reads = 0;
+        actor_id id;
+        hive_spawn(bus_fanout_driver, NULL, NULL, NULL, &id);
+        hive_run();
+        printf("    %4zu subscribers: %5lu ns/publish, %5lu ns/read\n",
+               counts[i],
+               s_fanout_pub_ns / (BUS_FANOUT_ROUNDS * BUS_FANOUT_BATCH),
+               s_fanout_reads ? s_fanout_read_ns / s_fanout_reads : 0);
+    }
+}
 
-    printf("  Publish latency:      %lu ns/msg\n", ns_per_pub);
-    printf("  Throughput:           %.2f M msgs/sec\n",
-           pubs_per_sec / 1000000.0);
+// Latest-value mode against the ring: one subscriber that only wants the
+// newest sample. Publish-only runs keep the ring full, so every ring publish
+// evicts, frees and allocates; the latest-value slot is overwritten in place.
+#define BUS_LATEST_OPS 100000
 
-    free(ctx_pub);
-    free(ctx_sub);
+static hive_bus_mode s_latest_mode;
+static uint64_t s_latest_pub_ns;
+static uint64_t s_latest_pair_ns;
+
+static void bus_latest_actor(void *args, const hive_spawn_info *siblings,
+                             size_t sibling_count) {
+    (void)args;
+    (void)siblings;
+    (void)sibling_count;
+    hive_bus_config cfg = {.max_entries = 16,
+                           .max_entry_size = 64,
+                           .max_subscribers = 1,
+                           .consume_after_reads = 0,
+                           .max_age_ms = 0,
+                           .mode = s_latest_mode};
+    bus_id bus;
+    if (HIVE_FAILED(hive_bus_create(&cfg, &bus))) {
+        hive_exit();
+    }
+    hive_bus_subscribe(bus);
+
+    uint8_t data[64] = {0};
+    uint8_t buf[64];
+    size_t len;
+    uint64_t start = get_nanos();
+    for (int i = 0; i < BUS_LATEST_OPS; i++) {
+        data[0] = (uint8_t)i;
+        hive_bus_publish(bus, data, sizeof(data));
+    }
+    s_latest_pub_ns = (get_nanos() - start) / BUS_LATEST_OPS;
+
+    // Drain the ring so each pair below reads the sample just published
+    while (HIVE_SUCCEEDED(hive_bus_read(bus, buf, sizeof(buf), &len))) {
+    }
+    start = get_nanos();
+    for (int i = 0; i < BUS_LATEST_OPS; i++) {
+        data[0] = (uint8_t)i;
+        hive_bus_publish(bus, data, sizeof(data));
+        hive_bus_read(bus, buf, sizeof(buf), &len);
+    }
+    s_latest_pair_ns = (get_nanos() - start) / BUS_LATEST_OPS;
 
+    hive_bus_unsubscribe(bus);
     hive_bus_destroy(bus);
-    printf("\n");
+    hive_exit();
 }
 
-// ============================================================================
-// Main
-// ============================================================================
+static void bench_bus_latest(void) {
+    static const struct {
+        hive_bus_mode mode;
+        const char *name;
+    } modes[] = {{HIVE_BUS_RING, "ring (16 entries)"},
+                 {HIVE_BUS_LATEST, "latest-value"}};
+
+    printf("  Latest-value vs ring mode (64-byte samples):\n");
+    for (size_t i = 0; i < sizeof(modes) / sizeof(modes[0]); i++) {
+        s_latest_mode = modes[i].mode;
+        s_latest_pub_ns = 0;
+        s_latest_pair_ns = 0;
+        actor_id id;
+        hive_spawn(bus_latest_actor, NULL, NULL, NULL, &id);
+        hive_run();
+        printf("    %-18s %5lu ns/publish, %5lu ns/publish+read\n",
+               modes[i].name, s_latest_pub_ns, s_latest_pair_ns);
+    }
+}
 
-int main(void) {
-    printf("\n");
-    printf("=================================================\n");
-    printf("  Actor Runtime Benchmark Suite\n");
-    printf("=================================================\n");
-    printf("\n");
-    printf("Configuration:\n");
-    printf("  HIVE_MAX_ACTORS:               %d\n", HIVE_MAX_ACTORS);
-    printf("  HIVE_MAILBOX_ENTRY_POOL_SIZE:  %d\n",
-           HIVE_MAILBOX_ENTRY_POOL_SIZE);
-    printf("  HIVE_MESSAGE_DATA_POOL_SIZE:   %d\n",
-           HIVE_MESSAGE_DATA_POOL_SIZE);
-    printf("  HIVE_DEFAULT_STACK_SIZE:       %d\n", HIVE_DEFAULT_STACK_SIZE);
-    printf("  Iterations:                  %d\n", ITERATIONS);
-    printf("\n");
+// Copy (hive_bus_read) against borrow (hive_bus_read_ref) by entry size.
+// Each round publishes half a ring and times reading it back.
+#define BUS_REF_READS 20000
+#define BUS_REF_BATCH 8
 
-    printf("Initializing runtime...\n");
-    fflush(stdout);
+static size_t s_ref_size;
+static bool s_ref_borrow;
+static uint64_t s_ref_ns;
 
-    // Initialize runtime
-    hive_status status = hive_init();
-    if (HIVE_FAILED(status)) {
-        fprintf(stderr, "Failed to initialize runtime: %s\n",
-                status.msg ? status.msg : "unknown error");
-        return 1;
+static void bus_ref_actor(void *args, const hive_spawn_info *siblings,
+                          size_t sibling_count) {
+    (void)args;
+    (void)siblings;
+    (void)sibling_count;
+    hive_bus_config cfg = {.max_entries = 2 * BUS_REF_BATCH,
+                           .max_entry_size = s_ref_size,
+                           .max_subscribers = 1,
+                           .consume_after_reads = 0,
+                           .max_age_ms = 0};
+    bus_id bus;
+    s_ref_ns = 0;
+    if (HIVE_FAILED(hive_bus_create(&cfg, &bus))) {
+        hive_exit();
     }
+    hive_bus_subscribe(bus);
+
+    uint8_t *data = calloc(1, s_ref_size);
+    uint8_t *buf = malloc(s_ref_size);
+    uint64_t total = 0;
+    for (int reads = 0; reads < BUS_REF_READS; reads += BUS_REF_BATCH) {
+        for (int i = 0; i < BUS_REF_BATCH; i++) {
+            hive_bus_publish(bus, data, s_ref_size);
+        }
+        uint64_t start = get_nanos();
+        for (int i = 0; i < BUS_REF_BATCH; i++) {
+            size_t len;
+            if (s_ref_borrow) {
+                const void *ref;
+                hive_bus_read_ref(bus, &ref, &len);
+            } else {
+                hive_bus_read(bus, buf, s_ref_size, &len);
+            }
+        }
+        total += get_nanos() - start;
+    }
+    s_ref_ns = total / BUS_REF_READS;
 
-    // Run benchmarks (all in single runtime session)
-    printf("Starting context switch benchmark...\n");
-    fflush(stdout);
-    bench_context_switch();
+    free(data);
+    free(buf);
+    hive_bus_unsubscribe(bus);
+    hive_bus_destroy(bus);
+    hive_exit();
+}
 
-    printf("Starting IPC benchmark...\n");
-    fflush(stdout);
-    bench_ipc();
+static void bench_bus_read_ref(void) {
+    static const size_t sizes[] = {64, 256, 1024, 4096};
 
-    printf("Starting pool allocation benchmark...\n");
-    fflush(stdout);
-    bench_pool_allocation();
+    printf("  Copy vs borrow (hive_bus_read vs hive_bus_read_ref):\n");
+    for (size_t i = 0; i < sizeof(sizes) / sizeof(sizes[0]); i++) {
+        if (sizes[i] > HIVE_MAX_MESSAGE_SIZE ||
+            2 * BUS_REF_BATCH > HIVE_MAX_BUS_ENTRIES) {
+            printf("    %4zu bytes: skipped (raise HIVE_MAX_MESSAGE_SIZE)\n",
+                   sizes[i]);
+            continue;
+        }
+        // Best of three runs: single reads are short enough for one VM
+        // preemption to swamp the average
+        uint64_t ns[2] = {UINT64_MAX, UINT64_MAX};
+        for (int run = 0; run < 6; run++) {
+            int borrow = run & 1;
+            s_ref_size = sizes[i];
+            s_ref_borrow = borrow;
+            actor_id id;
+            hive_spawn(bus_ref_actor, NULL, NULL, NULL, &id);
+            hive_run();
+            if (s_ref_ns < ns[borrow]) {
+                ns[borrow] = s_ref_ns;
+            }
+        }
+        printf("    %4zu bytes: %5lu ns/copy, %5lu ns/borrow\n", sizes[i],
+               ns[0], ns[1]);
+    }
+}
 
-    printf("Starting actor spawn benchmark...\n");
-    fflush(stdout);
-    bench_actor_spawn();
+// Publish cost while IPC traffic holds message pool entries. Bus payloads
+// live in each bus's own slab, so queued IPC messages should not matter.
+#define BUS_PRESSURE_PUBS 50000
 
-    printf("Starting bus benchmark...\n");
-    fflush(stdout);
-    bench_bus();
+static size_t s_pressure_queued;
+static uint64_t s_pressure_ns;
+
+static void bus_pressure_actor(void *args, const hive_spawn_info *siblings,
+                               size_t sibling_count) {
+    (void)args;
+    (void)siblings;
+    (void)sibling_count;
+    hive_bus_config cfg = {.max_entries = 16,
+                           .max_entry_size = 64,
+                           .max_subscribers = 1,
+                           .consume_after_reads = 0,
+                           .max_age_ms = 0};
+    bus_id bus;
+    s_pressure_ns = 0;
+    if (HIVE_FAILED(hive_bus_create(&cfg, &bus))) {
+        hive_exit();
+    }
+
+    actor_id self = hive_self();
+    for (size_t i = 0; i < s_pressure_queued; i++) {
+        hive_ipc_notify(self, 0, "x", 2);
+    }
+
+    uint8_t data[64] = {0};
+    uint64_t start = get_nanos();
+    for (int i = 0; i < BUS_PRESSURE_PUBS; i++) {
+        hive_bus_publish(bus, data, sizeof(data));
+    }
+    s_pressure_ns = (get_nanos() - start) / BUS_PRESSURE_PUBS;
+
+    hive_message msg;
+    while (HIVE_SUCCEEDED(hive_ipc_recv(&msg, 0))) {
+    }
+    hive_bus_destroy(bus);
+    hive_exit();
+}
+
+static void bench_bus_pool_pressure(void) {
+    const size_t queued[] = {0, HIVE_MESSAGE_DATA_POOL_SIZE / 2,
+                             HIVE_MESSAGE_DATA_POOL_SIZE - 16};
+
+    printf("  Publish with IPC messages queued (pool of %d):\n",
+           HIVE_MESSAGE_DATA_POOL_SIZE);
+    for (size_t i = 0; i < sizeof(queued) / sizeof(queued[0]); i++) {
+        // Best of three: a preempted run says nothing about the pool
+        uint64_t best = 0;
+        s_pressure_queued = queued[i];
+        for (int run = 0; run < 3; run++) {
+            actor_id id;
+            hive_spawn(bus_pressure_actor, NULL, NULL, NULL, &id);
+            hive_run();
+            if (run == 0 || s_pressure_ns < best) {
+                best = s_pressure_ns;
+            }
+        }
+        printf("    %4zu queued: %5lu ns/publish\n", queued[i], best);
+    }
+}
+
+// Bus id lookup with the bus table full: publish plus entry count on the
+// first and on the last bus created. Every bus call resolves its id first.
+#define BUS_LOOKUP_OPS 100000
+
+static uint64_t s_lookup_first_ns;
+static uint64_t s_lookup_last_ns;
+static size_t s_lookup_buses;
+
+// Best of three runs, as a preempted run would swamp the lookup
+static uint64_t time_bus_ops(bus_id bus) {
+    uint8_t data[8] = {0};
+    uint64_t best = 0;
+    for (int run = 0; run < 3; run++) {
+        size_t n = 0;
+        uint64_t start = get_nanos();
+        for (int i = 0; i < BUS_LOOKUP_OPS; i++) {
+            hive_bus_publish(bus, data, sizeof(data));
+            n += hive_bus_entry_count(bus);
+        }
+        uint64_t ns = (get_nanos() - start) / BUS_LOOKUP_OPS;
+        if (n == 0) {
+            return 0; // Bus not found
+        }
+        if (run == 0 || ns < best) {
+            best = ns;
+        }
+    }
+    return best;
+}
+
+static void bus_lookup_actor(void *args, const hive_spawn_info *siblings,
+                             size_t sibling_count) {
+    (void)args;
+    (void)siblings;
+    (void)sibling_count;
+    static bus_id buses[HIVE_MAX_BUSES];
+    hive_bus_config cfg = {.max_entries = 1,
+                           .max_entry_size = 8,
+                           .max_subscribers = 1,
+                           .consume_after_reads = 0,
+                           .max_age_ms = 0};
+    s_lookup_buses = 0;
+    while (s_lookup_buses < HIVE_MAX_BUSES &&
+           HIVE_SUCCEEDED(hive_bus_create(&cfg, &buses[s_lookup_buses]))) {
+        s_lookup_buses++;
+    }
+    if (s_lookup_buses > 0) {
+        s_lookup_first_ns = time_bus_ops(buses[0]);
+        s_lookup_last_ns = time_bus_ops(buses[s_lookup_buses - 1]);
+    }
+    for (size_t i = 0; i < s_lookup_buses; i++) {
+        hive_bus_destroy(buses[i]);
+    }
+    hive_exit();
+}
+
+static void bench_bus_lookup(void) {
+    actor_id id;
+    hive_spawn(bus_lookup_actor, NULL, NULL, NULL, &id);
+    hive_run();
+    printf("  Bus lookup, %zu buses live (publish + entry count):\n",
+           s_lookup_buses);
+    printf("    first bus: %5lu ns/op\n", s_lookup_first_ns);
+    printf("    last bus:  %5lu ns/op\n", s_lookup_last_ns);
+}
+
+// Full-rate and telemetry subscribers on one bus: telemetry wants every
+// 10th entry, either discarding the rest after reading them or through a
+// decimating subscription that is never woken for them
+#define BUS_DECIM_PUBS 20000
+#define BUS_DECIM_FULL 4
+#define BUS_DECIM_TELEM 4
+#define BUS_DECIM_N 10
+
+static bus_id s_decim_bus;
+static bool s_decim_filtered;
+static int s_decim_ready;
+static uint64_t s_decim_wakeups;
+static uint64_t s_decim_used;
+static uint64_t s_decim_ns;
+
+static void bus_decim_reader(void *args, const hive_spawn_info *siblings,
+                             size_t sibling_count) {
+    (void)siblings;
+    (void)sibling_count;
+    bool telemetry = args != NULL;
+    hive_bus_sub_opts opts = HIVE_BUS_SUB_OPTS_DEFAULT;
+    if (telemetry && s_decim_filtered) {
+        opts.decimation = BUS_DECIM_N;
+    }
+    hive_bus_subscribe_ex(s_decim_bus, &opts);
+    s_decim_ready++;
+
+    // Runs until the driver kills it, which also drops the subscription
+    uint32_t seq;
+    size_t len;
+    while (HIVE_SUCCEEDED(hive_bus_read_wait(s_decim_bus, &seq, sizeof(seq),
+                                             &len, -1))) {
+        if (telemetry) {
+            s_decim_wakeups++;
+            if (s_decim_filtered || seq % BUS_DECIM_N == 0) {
+                s_decim_used++;
+            }
+        }
+    }
+    hive_exit();
+}
+
+static void bus_decim_driver(void *args, const hive_spawn_info *siblings,
+                             size_t sibling_count) {
+    (void)args;
+    (void)siblings;
+    (void)sibling_count;
+    hive_bus_config cfg = {.max_entries = 16,
+                           .max_entry_size = sizeof(uint32_t),
+                           .max_subscribers =
+                               BUS_DECIM_FULL + BUS_DECIM_TELEM,
+                           .consume_after_reads = 0,
+                           .max_age_ms = 0};
+    hive_bus_create(&cfg, &s_decim_bus);
+
+    actor_config acfg = HIVE_ACTOR_CONFIG_DEFAULT;
+    acfg.stack_size = 16 * 1024;
+    acfg.malloc_stack = true;
+    actor_id readers[BUS_DECIM_FULL + BUS_DECIM_TELEM];
+    for (int i = 0; i < BUS_DECIM_FULL + BUS_DECIM_TELEM; i++) {
+        hive_spawn(bus_decim_reader, NULL,
+                   i < BUS_DECIM_FULL ? NULL : &s_decim_bus, &acfg,
+                   &readers[i]);
+    }
+    while (s_decim_ready < BUS_DECIM_FULL + BUS_DECIM_TELEM) {
+        hive_yield();
+    }
+
+    // One publish per scheduler pass: every woken reader runs in between
+    uint64_t start = get_nanos();
+    for (uint32_t seq = 0; seq < BUS_DECIM_PUBS; seq++) {
+        hive_bus_publish(s_decim_bus, &seq, sizeof(seq));
+        hive_yield();
+    }
+    s_decim_ns = (get_nanos() - start) / BUS_DECIM_PUBS;
+
+    for (int i = 0; i < BUS_DECIM_FULL + BUS_DECIM_TELEM; i++) {
+        hive_kill(readers[i]);
+    }
+    hive_bus_destroy(s_decim_bus);
+    hive_exit();
+}
+
+static void bench_bus_decimation(void) {
+    printf("  %d full-rate + %d telemetry subscribers (every %dth entry):\n",
+           BUS_DECIM_FULL, BUS_DECIM_TELEM, BUS_DECIM_N);
+    for (int filtered = 0; filtered <= 1; filtered++) {
+        s_decim_filtered = filtered;
+        s_decim_ready = 0;
+        s_decim_wakeups = 0;
+        s_decim_used = 0;
+        actor_id id;
+        hive_spawn(bus_decim_driver, NULL, NULL, NULL, &id);
+        hive_run();
+        printf("    %-22s %6lu telemetry wakeups (%lu used), %5lu ns/publish\n",
+               filtered ? "decimating subscribe:" : "read and discard:",
+               s_decim_wakeups, s_decim_used, s_decim_ns);
+    }
+}
+
+// Alarm watchers on a busy bus: each wants the rare sample whose value
+// crosses a threshold, either testing every sample after waking for it or
+// through a field filter checked at publish
+#define BUS_ALARM_PUBS 20000
+#define BUS_ALARM_WATCHERS 4
+#define BUS_ALARM_EVERY 1000
+
+typedef struct {
+    uint32_t seq;
+    float value;
+} alarm_sample;
+
+static bus_id s_alarm_bus;
+static bool s_alarm_filtered;
+static int s_alarm_ready;
+static uint64_t s_alarm_wakeups;
+static uint64_t s_alarm_alarms;
+static uint64_t s_alarm_ns;
+
+static void bus_alarm_watcher(void *args, const hive_spawn_info *siblings,
+                              size_t sibling_count) {
+    (void)args;
+    (void)siblings;
+    (void)sibling_count;
+    hive_bus_sub_opts opts = HIVE_BUS_SUB_OPTS_DEFAULT;
+    if (s_alarm_filtered) {
+        opts.field.op = HIVE_BUS_CMP_GT;
+        opts.field.type = HIVE_BUS_FIELD_F32;
+        opts.field.offset = offsetof(alarm_sample, value);
+        opts.field.value.f32 = 100.0f;
+    }
+    hive_bus_subscribe_ex(s_alarm_bus, &opts);
+    s_alarm_ready++;
+
+    // Runs until the driver kills it, which also drops the subscription
+    alarm_sample sample;
+    size_t len;
+    while (HIVE_SUCCEEDED(hive_bus_read_wait(s_alarm_bus, &sample,
+                                             sizeof(sample), &len, -1))) {
+        s_alarm_wakeups++;
+        if (sample.value > 100.0f) {
+            s_alarm_alarms++;
+        }
+    }
+    hive_exit();
+}
+
+static void bus_alarm_driver(void *args, const hive_spawn_info *siblings,
+                             size_t sibling_count) {
+    (void)args;
+    (void)siblings;
+    (void)sibling_count;
+    hive_bus_config cfg = {.max_entries = 16,
+                           .max_entry_size = sizeof(alarm_sample),
+                           .max_subscribers = BUS_ALARM_WATCHERS,
+                           .consume_after_reads = 0,
+                           .max_age_ms = 0};
+    hive_bus_create(&cfg, &s_alarm_bus);
+
+    actor_config acfg = HIVE_ACTOR_CONFIG_DEFAULT;
+    acfg.stack_size = 16 * 1024;
+    acfg.malloc_stack = true;
+    actor_id watchers[BUS_ALARM_WATCHERS];
+    for (int i = 0; i < BUS_ALARM_WATCHERS; i++) {
+        hive_spawn(bus_alarm_watcher, NULL, NULL, &acfg, &watchers[i]);
+    }
+    while (s_alarm_ready < BUS_ALARM_WATCHERS) {
+        hive_yield();
+    }
+
+    // One publish per scheduler pass: every woken watcher runs in between
+    uint64_t start = get_nanos();
+    for (uint32_t seq = 0; seq < BUS_ALARM_PUBS; seq++) {
+        alarm_sample sample = {
+            .seq = seq, .value = seq % BUS_ALARM_EVERY == 0 ? 150.0f : 20.0f};
+        hive_bus_publish(s_alarm_bus, &sample, sizeof(sample));
+        hive_yield();
+    }
+    s_alarm_ns = (get_nanos() - start) / BUS_ALARM_PUBS;
+
+    for (int i = 0; i < BUS_ALARM_WATCHERS; i++) {
+        hive_kill(watchers[i]);
+    }
+    hive_bus_destroy(s_alarm_bus);
+    hive_exit();
+}
+
+static void bench_bus_alarm(void) {
+    printf("  %d alarm watchers, 1 alarm per %d samples:\n",
+           BUS_ALARM_WATCHERS, BUS_ALARM_EVERY);
+    for (int filtered = 0; filtered <= 1; filtered++) {
+        s_alarm_filtered = filtered;
+        s_alarm_ready = 0;
+        s_alarm_wakeups = 0;
+        s_alarm_alarms = 0;
+        actor_id id;
+        hive_spawn(bus_alarm_driver, NULL, NULL, NULL, &id);
+        hive_run();
+        printf("    %-22s %6lu wakeups (%lu alarms), %5lu ns/publish\n",
+               filtered ? "field filter:" : "read and test:",
+               s_alarm_wakeups, s_alarm_alarms, s_alarm_ns);
+    }
+}
+
+// One producer feeding four consumers that each spend ~1 us per entry,
+// publishing in bursts twice the ring size. An evicting bus drops what the
+// consumers have not reached; a lossless one makes the producer wait.
+#define BUS_PIPE_ENTRIES 20000
+#define BUS_PIPE_CONSUMERS 4
+#define BUS_PIPE_RING 16
+#define BUS_PIPE_BURST 32
+#define BUS_PIPE_WORK_NS 1000
+
+typedef struct {
+    uint32_t seq;
+    uint64_t stamp_ns;
+} pipe_sample;
+
+static bus_id s_pipe_bus;
+static bool s_pipe_lossless;
+static int s_pipe_ready;
+static uint64_t s_pipe_received;
+static uint64_t s_pipe_lost;
+static uint64_t s_pipe_latency_ns;
+static uint64_t s_pipe_elapsed_ns;
+
+static void bus_pipe_consumer(void *args, const hive_spawn_info *siblings,
+                              size_t sibling_count) {
+    (void)args;
+    (void)siblings;
+    (void)sibling_count;
+    hive_bus_subscribe(s_pipe_bus);
+    s_pipe_ready++;
+
+    pipe_sample sample;
+    size_t len;
+    while (HIVE_SUCCEEDED(hive_bus_read_wait(s_pipe_bus, &sample,
+                                             sizeof(sample), &len, -1))) {
+        uint64_t now = get_nanos();
+        s_pipe_latency_ns += now - sample.stamp_ns;
+        s_pipe_received++;
+        while (get_nanos() - now < BUS_PIPE_WORK_NS) {
+        }
+        if (sample.seq == BUS_PIPE_ENTRIES - 1) {
+            break;
+        }
+    }
+    uint64_t missed = 0;
+    hive_bus_missed(s_pipe_bus, &missed);
+    s_pipe_lost += missed;
+    hive_bus_unsubscribe(s_pipe_bus);
+    s_pipe_ready--;
+    hive_exit();
+}
+
+static void bus_pipe_producer(void *args, const hive_spawn_info *siblings,
+                              size_t sibling_count) {
+    (void)args;
+    (void)siblings;
+    (void)sibling_count;
+    hive_bus_config cfg = {.max_entries = BUS_PIPE_RING,
+                           .max_entry_size = sizeof(pipe_sample),
+                           .max_subscribers = BUS_PIPE_CONSUMERS,
+                           .overflow = s_pipe_lossless
+                                           ? HIVE_BUS_OVERFLOW_BLOCK
+                                           : HIVE_BUS_OVERFLOW_EVICT};
+    hive_bus_create(&cfg, &s_pipe_bus);
+
+    actor_config acfg = HIVE_ACTOR_CONFIG_DEFAULT;
+    acfg.stack_size = 16 * 1024;
+    acfg.malloc_stack = true;
+    for (int i = 0; i < BUS_PIPE_CONSUMERS; i++) {
+        actor_id consumer;
+        hive_spawn(bus_pipe_consumer, NULL, NULL, &acfg, &consumer);
+    }
+    while (s_pipe_ready < BUS_PIPE_CONSUMERS) {
+        hive_yield();
+    }
+
+    uint64_t start = get_nanos();
+    for (uint32_t seq = 0; seq < BUS_PIPE_ENTRIES; seq++) {
+        pipe_sample sample = {.seq = seq, .stamp_ns = get_nanos()};
+        hive_bus_publish_wait(s_pipe_bus, &sample, sizeof(sample), -1);
+        if (seq % BUS_PIPE_BURST == BUS_PIPE_BURST - 1) {
+            hive_yield();
+        }
+    }
+    while (s_pipe_ready > 0) {
+        hive_yield();
+    }
+    s_pipe_elapsed_ns = get_nanos() - start;
+
+    hive_bus_destroy(s_pipe_bus);
+    hive_exit();
+}
+
+static void bench_bus_pipeline(void) {
+    printf("  1 producer, %d consumers (~1 us/entry), %d-entry ring:\n",
+           BUS_PIPE_CONSUMERS, BUS_PIPE_RING);
+    for (int lossless = 0; lossless <= 1; lossless++) {
+        s_pipe_lossless = lossless;
+        s_pipe_ready = 0;
+        s_pipe_received = 0;
+        s_pipe_lost = 0;
+        s_pipe_latency_ns = 0;
+        actor_id id;
+        hive_spawn(bus_pipe_producer, NULL, NULL, NULL, &id);
+        hive_run();
+        uint64_t received = s_pipe_received ? s_pipe_received : 1;
+        printf("    %-10s %6lu lost, %5.2f M entries/s delivered, "
+               "%5lu ns mean latency\n",
+               lossless ? "lossless:" : "evict:", s_pipe_lost,
+               (double)s_pipe_received / ((double)s_pipe_elapsed_ns / 1000.0),
+               s_pipe_latency_ns / received);
+    }
+}
+
+// Burst catch-up: 64 entries published at once, then read back by a
+// subscriber that fell behind, one call per entry or one call per burst.
+// Four more subscribers sit blocked on the bus, and max_age_ms is set so
+// every call runs the expiry check.
+#define BUS_BATCH_BURST 64
+#define BUS_BATCH_ROUNDS 2000
+#define BUS_BATCH_WATCHERS 4
+
+typedef struct {
+    uint32_t seq;
+    uint32_t payload[3];
+} batch_sample;
+
+static bus_id s_batch_bus;
+static bool s_batch_mode;
+static int s_batch_ready;
+static uint64_t s_batch_pub_ns;
+static uint64_t s_batch_read_ns;
+
+static void bus_batch_watcher(void *args, const hive_spawn_info *siblings,
+                              size_t sibling_count) {
+    (void)args;
+    (void)siblings;
+    (void)sibling_count;
+    hive_bus_subscribe(s_batch_bus);
+    s_batch_ready++;
+
+    // Runs until the driver kills it
+    static batch_sample burst[BUS_BATCH_BURST];
+    size_t lens[BUS_BATCH_BURST];
+    size_t n;
+    for (;;) {
+        hive_bus_read_wait(s_batch_bus, &burst[0], sizeof(burst[0]), &n, -1);
+        hive_bus_read_batch(s_batch_bus, burst, sizeof(burst[0]),
+                            BUS_BATCH_BURST, lens, &n);
+    }
+}
+
+static void bus_batch_driver(void *args, const hive_spawn_info *siblings,
+                             size_t sibling_count) {
+    (void)args;
+    (void)siblings;
+    (void)sibling_count;
+    hive_bus_config cfg = {.max_entries = BUS_BATCH_BURST,
+                           .max_entry_size = sizeof(batch_sample),
+                           .max_subscribers = BUS_BATCH_WATCHERS + 1,
+                           .consume_after_reads = 0,
+                           .max_age_ms = 60000};
+    hive_bus_create(&cfg, &s_batch_bus);
+    hive_bus_subscribe(s_batch_bus);
+
+    actor_config acfg = HIVE_ACTOR_CONFIG_DEFAULT;
+    acfg.stack_size = 16 * 1024;
+    acfg.malloc_stack = true;
+    actor_id watchers[BUS_BATCH_WATCHERS];
+    for (int i = 0; i < BUS_BATCH_WATCHERS; i++) {
+        hive_spawn(bus_batch_watcher, NULL, NULL, &acfg, &watchers[i]);
+    }
+    while (s_batch_ready < BUS_BATCH_WATCHERS) {
+        hive_yield();
+    }
+
+    static batch_sample out[BUS_BATCH_BURST];
+    static batch_sample in[BUS_BATCH_BURST];
+    size_t lens[BUS_BATCH_BURST];
+    for (int i = 0; i < BUS_BATCH_BURST; i++) {
+        out[i].seq = (uint32_t)i;
+        lens[i] = sizeof(out[0]);
+    }
+
+    uint64_t pub_ns = 0;
+    uint64_t read_ns = 0;
+    for (int round = 0; round < BUS_BATCH_ROUNDS; round++) {
+        uint64_t t0 = get_nanos();
+        if (s_batch_mode) {
+            hive_bus_publish_batch(s_batch_bus, out, sizeof(out[0]), lens,
+                                   BUS_BATCH_BURST, NULL);
+        } else {
+            for (int i = 0; i < BUS_BATCH_BURST; i++) {
+                hive_bus_publish(s_batch_bus, &out[i], sizeof(out[i]));
+            }
+        }
+        uint64_t t1 = get_nanos();
+        size_t n;
+        if (s_batch_mode) {
+            hive_bus_read_batch(s_batch_bus, in, sizeof(in[0]),
+                                BUS_BATCH_BURST, lens, &n);
+        } else {
+            for (int i = 0; i < BUS_BATCH_BURST; i++) {
+                hive_bus_read(s_batch_bus, &in[i], sizeof(in[i]), &n);
+            }
+        }
+        uint64_t t2 = get_nanos();
+        pub_ns += t1 - t0;
+        read_ns += t2 - t1;
+        hive_yield(); // Watchers drain and block again
+    }
+    s_batch_pub_ns = pub_ns / (BUS_BATCH_ROUNDS * BUS_BATCH_BURST);
+    s_batch_read_ns = read_ns / (BUS_BATCH_ROUNDS * BUS_BATCH_BURST);
+
+    for (int i = 0; i < BUS_BATCH_WATCHERS; i++) {
+        hive_kill(watchers[i]);
+    }
+    hive_bus_unsubscribe(s_batch_bus);
+    hive_bus_destroy(s_batch_bus);
+    hive_exit();
+}
+
+static void bench_bus_batch(void) {
+    printf("  Burst catch-up, %d entries per burst, %d blocked "
+           "subscribers:\n",
+           BUS_BATCH_BURST, BUS_BATCH_WATCHERS);
+    for (int batch = 0; batch <= 1; batch++) {
+        s_batch_mode = batch;
+        uint64_t best_pub = UINT64_MAX;
+        uint64_t best_read = UINT64_MAX;
+        for (int run = 0; run < 3; run++) {
+            s_batch_ready = 0;
+            actor_id id;
+            hive_spawn(bus_batch_driver, NULL, NULL, NULL, &id);
+            hive_run();
+            best_pub = s_batch_pub_ns < best_pub ? s_batch_pub_ns : best_pub;
+            best_read =
+                s_batch_read_ns < best_read ? s_batch_read_ns : best_read;
+        }
+        printf("    %-17s %4lu ns/entry publish, %4lu ns/entry read\n",
+               batch ? "batch calls:" : "one per entry:", best_pub,
+               best_read);
+    }
+}
+
+static void bench_bus(void) __attribute__((unused));
+static void bench_bus(void) {
+    printf("Bus Performance\n");
+    printf("---------------\n");
+
+    // Create bus with enough capacity for benchmark messages
+    hive_bus_config cfg = {
+        .max_entries = 64,     // Max allowed by HIVE_MAX_BUS_ENTRIES
+        .max_entry_size = 256, // Max size of each message
+        .max_subscribers = 8,
+        .consume_after_reads = 1, // Remove entries after 1 reader reads them
+        .max_age_ms = 0};
+    bus_id bus;
+    hive_bus_create(&cfg, &bus);
+
+    // Warmup
+    bus_ctx *ctx_pub_warmup = calloc(1, sizeof(bus_ctx));
+    bus_ctx *ctx_sub_warmup = calloc(1, sizeof(bus_ctx));
+
+    ctx_pub_warmup->bus = bus;
+    ctx_pub_warmup->max_count = 100;
+    ctx_sub_warmup->bus = bus;
+    ctx_sub_warmup->max_count = 100;
+
+    actor_id sub_warmup;
+    hive_spawn(bus_subscriber, NULL, ctx_sub_warmup, NULL, &sub_warmup);
+    actor_id pub_warmup;
+    hive_spawn(bus_publisher, NULL, ctx_pub_warmup, NULL, &pub_warmup);
+    hive_run();
+
+    free(ctx_pub_warmup);
+    free(ctx_sub_warmup);
+
+    // Benchmark publish latency
+    // Use moderate iterations - publisher yields every 10 messages to cooperate
+    const uint64_t BUS_ITERATIONS = 1000;
+
+    bus_ctx *ctx_pub = calloc(1, sizeof(bus_ctx));
+    bus_ctx *ctx_sub = calloc(1, sizeof(bus_ctx));
+
+    ctx_pub->bus = bus;
+    ctx_pub->max_count = BUS_ITERATIONS;
+    ctx_sub->bus = bus;
+    ctx_sub->max_count = BUS_ITERATIONS;
+
+    actor_id sub;
+    hive_spawn(bus_subscriber, NULL, ctx_sub, NULL, &sub);
+    actor_id pub;
+    hive_spawn(bus_publisher, NULL, ctx_pub, NULL, &pub);
+    hive_run();
+
+    uint64_t elapsed = ctx_pub->end_time - ctx_pub->start_time;
+    uint64_t ns_per_pub = elapsed / BUS_ITERATIONS;
+    double pubs_per_sec = (double)BUS_ITERATIONS / ((double)elapsed / BILLION);
+
+    printf("  Publish latency:      %lu ns/msg\n", ns_per_pub);
+    printf("  Throughput:           %.2f M msgs/sec\n",
+           pubs_per_sec / 1000000.0);
+
+    free(ctx_pub);
+    free(ctx_sub);
+
+    hive_bus_destroy(bus);
+
+    bench_bus_depths();
+    bench_bus_fanout();
+    bench_bus_latest();
+    bench_bus_read_ref();
+    bench_bus_pool_pressure();
+    bench_bus_lookup();
+    bench_bus_decimation();
+    bench_bus_alarm();
+    bench_bus_pipeline();
+    bench_bus_batch();
+    printf("\n");
+}
+
+// ============================================================================
+// 6. Batching Key/Value Server Benchmark
+// ============================================================================
+
+#define KV_CLIENTS 8
+#define KV_BATCH KV_CLIENTS
+#define KV_KEYS 64
+#define KV_VALUE_SIZE 192
+
+typedef struct {
+    uint32_t key;
+    uint8_t value[KV_VALUE_SIZE];
+} kv_put;
+
+typedef struct {
+    bool retain; // Hold requests with hive_msg_retain() instead of copying
+    uint64_t max_count;
+    uint64_t start_time;
+    uint64_t end_time;
+    uint8_t table[KV_KEYS][KV_VALUE_SIZE];
+} kv_server_ctx;
+
+typedef struct {
+    actor_id server;
+    uint64_t max_count;
+} kv_client_ctx;
+
+static void kv_server(void *args, const hive_spawn_info *siblings,
+                      size_t sibling_count) {
+    (void)siblings;
+    (void)sibling_count;
+    kv_server_ctx *ctx = (kv_server_ctx *)args;
+    hive_message reqs[KV_BATCH];
+    hive_reply_handle handles[KV_BATCH];
+    kv_put staged[KV_BATCH];
+
+    ctx->start_time = get_nanos();
+
+    for (uint64_t done = 0; done < ctx->max_count; done += KV_BATCH) {
+        // Collect a batch of puts before touching the table
+        for (int i = 0; i < KV_BATCH; i++) {
+            hive_ipc_recv_match(HIVE_SENDER_ANY, HIVE_MSG_REQUEST, HIVE_TAG_ANY,
+                                &reqs[i], -1);
+            hive_ipc_defer_reply(&reqs[i], &handles[i]);
+            if (ctx->retain) {
+                hive_msg_retain(&reqs[i]);
+            } else {
+                memcpy(&staged[i], reqs[i].data, sizeof(kv_put));
+            }
+        }
+
+        // Apply batch, then answer every client
+        for (int i = 0; i < KV_BATCH; i++) {
+            const kv_put *put =
+                ctx->retain ? (const kv_put *)reqs[i].data : &staged[i];
+            memcpy(ctx->table[put->key % KV_KEYS], put->value, KV_VALUE_SIZE);
+            if (ctx->retain) {
+                hive_msg_release(&reqs[i]);
+            }
+            hive_ipc_reply_deferred(&handles[i], NULL, 0);
+        }
+    }
+
+    ctx->end_time = get_nanos();
+    hive_exit();
+}
+
+static void kv_client(void *args, const hive_spawn_info *siblings,
+                      size_t sibling_count) {
+    (void)siblings;
+    (void)sibling_count;
+    kv_client_ctx *ctx = (kv_client_ctx *)args;
+    kv_put put;
+    memset(put.value, 0xCC, sizeof(put.value));
+
+    for (uint64_t i = 0; i < ctx->max_count; i++) {
+        put.key = (uint32_t)i;
+        hive_message reply;
+        hive_ipc_request(ctx->server, &put, sizeof(put), &reply, -1);
+    }
+
+    hive_exit();
+}
+
+static void bench_kv_server_run(bool retain, const char *label) {
+    kv_server_ctx *server_ctx = calloc(1, sizeof(kv_server_ctx));
+    kv_client_ctx client_ctx;
+
+    server_ctx->retain = retain;
+    server_ctx->max_count = ITERATIONS / KV_CLIENTS * KV_CLIENTS;
+
+    actor_id server;
+    hive_spawn(kv_server, NULL, server_ctx, NULL, &server);
+    client_ctx.server = server;
+    client_ctx.max_count = ITERATIONS / KV_CLIENTS;
+    for (int i = 0; i < KV_CLIENTS; i++) {
+        actor_id client;
+        hive_spawn(kv_client, NULL, &client_ctx, NULL, &client);
+    }
+
+    hive_run();
+
+    uint64_t elapsed = server_ctx->end_time - server_ctx->start_time;
+    uint64_t ns_per_req = elapsed / server_ctx->max_count;
+    double reqs_per_sec =
+        (double)server_ctx->max_count / ((double)elapsed / BILLION);
+
+    printf("  %-20s %6lu ns/req  (%.2f M reqs/sec)\n", label, ns_per_req,
+           reqs_per_sec / 1000000.0);
+
+    free(server_ctx);
+}
+
+static void bench_kv_server(void) __attribute__((unused));
+static void bench_kv_server(void) {
+    printf("Batching Key/Value Server\n");
+    printf("-------------------------\n");
+    printf("  (%d clients, batch of %d puts, %zu byte requests)\n\n",
+           KV_CLIENTS, KV_BATCH, sizeof(kv_put));
+
+    bench_kv_server_run(false, "Copy to staging:");
+    bench_kv_server_run(true, "Retain (no copy):");
+
+    printf("\n");
+}
+
+// ============================================================================
+// 7. Routing Chain Benchmark
+// ============================================================================
+
+#define ROUTE_HOPS 3
+#define ROUTE_MSG_SIZE 128
+
+typedef struct {
+    bool forward; // Route with hive_ipc_forward() instead of re-sending a copy
+    uint64_t max_count;
+    actor_id producer;
+    actor_id next[ROUTE_HOPS - 1]; // Router 1, router 2
+    actor_id sink;
+    uint64_t start_time;
+    uint64_t end_time;
+} route_ctx;
+
+typedef struct {
+    route_ctx *ctx;
+    int hop;
+} route_router_args;
+
+static void route_producer(void *args, const hive_spawn_info *siblings,
+                           size_t sibling_count) {
+    (void)siblings;
+    (void)sibling_count;
+    route_ctx *ctx = (route_ctx *)args;
+    uint8_t buffer[ROUTE_MSG_SIZE];
+    memset(buffer, 0xDD, sizeof(buffer));
+
+    ctx->start_time = get_nanos();
+
+    for (uint64_t i = 0; i < ctx->max_count; i++) {
+        hive_ipc_notify(ctx->next[0], 0, buffer, sizeof(buffer));
+
+        // Wait for sink ack
+        hive_message ack;
+        hive_ipc_recv(&ack, -1);
+    }
+
+    ctx->end_time = get_nanos();
+    hive_exit();
+}
+
+static void route_router(void *args, const hive_spawn_info *siblings,
+                         size_t sibling_count) {
+    (void)siblings;
+    (void)sibling_count;
+    route_router_args *r = (route_router_args *)args;
+    route_ctx *ctx = r->ctx;
+    actor_id to =
+        r->hop + 1 < ROUTE_HOPS - 1 ? ctx->next[r->hop + 1] : ctx->sink;
+
+    for (uint64_t i = 0; i < ctx->max_count; i++) {
+        hive_message msg;
+        hive_ipc_recv(&msg, -1);
+        if (ctx->forward) {
+            hive_ipc_forward(&msg, to);
+        } else {
+            hive_ipc_notify_ex(to, msg.class, msg.tag, msg.data, msg.len);
+        }
+    }
+
+    hive_exit();
+}
+
+static void route_sink(void *args, const hive_spawn_info *siblings,
+                       size_t sibling_count) {
+    (void)siblings;
+    (void)sibling_count;
+    route_ctx *ctx = (route_ctx *)args;
+    uint8_t ack = 1;
+
+    for (uint64_t i = 0; i < ctx->max_count; i++) {
+        hive_message msg;
+        hive_ipc_recv(&msg, -1);
+        hive_ipc_notify(ctx->producer, 0, &ack, sizeof(ack));
+    }
+
+    hive_exit();
+}
+
+static void bench_routing_run(bool forward, const char *label) {
+    route_ctx *ctx = calloc(1, sizeof(route_ctx));
+    route_router_args router_args[ROUTE_HOPS - 1];
+
+    ctx->forward = forward;
+    ctx->max_count = ITERATIONS;
+
+    // Spawn back to front so every hop knows its successor
+    hive_spawn(route_sink, NULL, ctx, NULL, &ctx->sink);
+    for (int hop = ROUTE_HOPS - 2; hop >= 0; hop--) {
+        router_args[hop] = (route_router_args){ctx, hop};
+        hive_spawn(route_router, NULL, &router_args[hop], NULL,
+                   &ctx->next[hop]);
+    }
+    hive_spawn(route_producer, NULL, ctx, NULL, &ctx->producer);
+
+    hive_run();
+
+    uint64_t elapsed = ctx->end_time - ctx->start_time;
+    uint64_t ns_per_msg = elapsed / ITERATIONS;
+    double msgs_per_sec = (double)ITERATIONS / ((double)elapsed / BILLION);
+
+    printf("  %-20s %6lu ns/msg  (%.2f M msgs/sec)\n", label, ns_per_msg,
+           msgs_per_sec / 1000000.0);
+
+    free(ctx);
+}
+
+static void bench_routing(void) __attribute__((unused));
+static void bench_routing(void) {
+    printf("Routing Chain (%d hops)\n", ROUTE_HOPS);
+    printf("----------------------\n");
+    printf("  (%d byte payload, end-to-end including sink ack)\n\n",
+           ROUTE_MSG_SIZE);
+
+    bench_routing_run(false, "Copy per hop:");
+    bench_routing_run(true, "Forward (no copy):");
+
+    printf("\n");
+}
+
+// ============================================================================
+// 8. Multicast Fan-out Benchmark
+// ============================================================================
+
+#define FANOUT_ROUNDS 100
+#define FANOUT_MSG_SIZE 64
+#define FANOUT_STACK_SIZE (16 * 1024)
+
+typedef struct {
+    bool multicast; // hive_ipc_multicast() instead of a notify loop
+    size_t fanout;
+    group_id group;
+    actor_id sender;
+    actor_id *receivers;
+    uint64_t send_time; // Accumulated time spent in send calls
+    uint64_t start_time;
+    uint64_t end_time;
+} fanout_ctx;
+
+static void fanout_receiver(void *args, const hive_spawn_info *siblings,
+                            size_t sibling_count) {
+    (void)siblings;
+    (void)sibling_count;
+    fanout_ctx *ctx = (fanout_ctx *)args;
+    uint8_t ack = 1;
+
+    if (ctx->multicast) {
+        hive_group_join(ctx->group);
+    }
+    hive_ipc_notify(ctx->sender, 0, &ack, sizeof(ack));
+
+    for (int i = 0; i < FANOUT_ROUNDS; i++) {
+        hive_message msg;
+        hive_ipc_recv(&msg, -1);
+        hive_ipc_notify(ctx->sender, 0, &ack, sizeof(ack));
+    }
+
+    hive_exit();
+}
+
+static void fanout_sender(void *args, const hive_spawn_info *siblings,
+                          size_t sibling_count) {
+    (void)siblings;
+    (void)sibling_count;
+    fanout_ctx *ctx = (fanout_ctx *)args;
+    uint8_t buffer[FANOUT_MSG_SIZE];
+    memset(buffer, 0xEE, sizeof(buffer));
+
+    actor_config cfg = HIVE_ACTOR_CONFIG_DEFAULT;
+    cfg.stack_size = FANOUT_STACK_SIZE;
+    cfg.malloc_stack = true;
+    for (size_t i = 0; i < ctx->fanout; i++) {
+        hive_spawn(fanout_receiver, NULL, ctx, &cfg, &ctx->receivers[i]);
+    }
+
+    // Wait until every receiver is ready (joined the group)
+    hive_message msg;
+    for (size_t i = 0; i < ctx->fanout; i++) {
+        hive_ipc_recv(&msg, -1);
+    }
+
+    ctx->start_time = get_nanos();
+
+    for (int round = 0; round < FANOUT_ROUNDS; round++) {
+        uint64_t t0 = get_nanos();
+        if (ctx->multicast) {
+            hive_ipc_multicast(ctx->group, 0, buffer, sizeof(buffer));
+        } else {
+            for (size_t i = 0; i < ctx->fanout; i++) {
+                hive_ipc_notify(ctx->receivers[i], 0, buffer, sizeof(buffer));
+            }
+        }
+        ctx->send_time += get_nanos() - t0;
+
+        // Collect acks so mailboxes drain before the next round
+        for (size_t i = 0; i < ctx->fanout; i++) {
+            hive_ipc_recv(&msg, -1);
+        }
+    }
+
+    ctx->end_time = get_nanos();
+    hive_exit();
+}
+
+static void bench_fanout_run(size_t fanout, bool multicast) {
+    fanout_ctx *ctx = calloc(1, sizeof(fanout_ctx));
+    ctx->multicast = multicast;
+    ctx->fanout = fanout;
+    ctx->receivers = calloc(fanout, sizeof(actor_id));
+    hive_group_create(&ctx->group);
+
+    hive_spawn(fanout_sender, NULL, ctx, NULL, &ctx->sender);
+    hive_run();
+
+    uint64_t send_ns = ctx->send_time / FANOUT_ROUNDS;
+    uint64_t round_ns = (ctx->end_time - ctx->start_time) / FANOUT_ROUNDS;
+
+    // Payload pool bytes held by one fan-out until every receiver consumed it
+    size_t payload_bytes = (multicast ? 1 : fanout) * HIVE_MAX_MESSAGE_SIZE;
+
+    printf("  %4zu actors %-10s %8lu ns/send %9lu ns/round %7zu B payload\n",
+           fanout, multicast ? "multicast" : "notify", send_ns, round_ns,
+           payload_bytes);
+
+    hive_group_destroy(ctx->group);
+    free(ctx->receivers);
+    free(ctx);
+}
+
+static void bench_fanout(void) __attribute__((unused));
+static void bench_fanout(void) {
+    printf("Multicast Fan-out\n");
+    printf("-----------------\n");
+    printf("  (%d byte payload, %d rounds, acks collected each round)\n\n",
+           FANOUT_MSG_SIZE, FANOUT_ROUNDS);
+
+    // Largest fan-out the compile-time pools allow (benchmark + sender +
+    // receivers; notify loop needs one data entry per receiver)
+    size_t limit = HIVE_MAX_ACTORS - 2;
+    if (limit > HIVE_MAILBOX_ENTRY_POOL_SIZE) {
+        limit = HIVE_MAILBOX_ENTRY_POOL_SIZE;
+    }
+    if (limit > HIVE_MESSAGE_DATA_POOL_SIZE) {
+        limit = HIVE_MESSAGE_DATA_POOL_SIZE;
+    }
+    if (limit > HIVE_GROUP_MEMBER_POOL_SIZE) {
+        limit = HIVE_GROUP_MEMBER_POOL_SIZE;
+    }
+
+    const size_t sizes[] = {10, 100, 1000};
+    for (size_t i = 0; i < sizeof(sizes) / sizeof(sizes[0]); i++) {
+        if (sizes[i] > limit) {
+            printf("  %4zu actors skipped (limit %zu; raise HIVE_MAX_ACTORS, "
+                   "pool sizes and HIVE_GROUP_MEMBER_POOL_SIZE)\n",
+                   sizes[i], limit);
+            continue;
+        }
+        bench_fanout_run(sizes[i], false);
+        bench_fanout_run(sizes[i], true);
+    }
+
+    printf("\n");
+}
+
+// ============================================================================
+// 9. Control-Plane Latency Benchmark
+// ============================================================================
+
+#define CONTROL_TARGET_DEPTH 10000
+#define CONTROL_MSG_SIZE 64
+#define CONTROL_TAG_DATA 1
+#define CONTROL_TAG_STOP 2
+
+typedef struct {
+    actor_id worker;
+    bool urgent; // Stop sent with hive_ipc_notify_urgent()
+    size_t depth;
+    size_t drained; // Data messages handled before the stop
+    uint64_t stop_sent;
+    uint64_t stop_seen;
+} control_ctx;
+
+static void control_worker(void *args, const hive_spawn_info *siblings,
+                           size_t sibling_count) {
+    (void)siblings;
+    (void)sibling_count;
+    control_ctx *ctx = (control_ctx *)args;
+
+    hive_message msg;
+    while (HIVE_SUCCEEDED(hive_ipc_recv(&msg, -1))) {
+        if (msg.tag == CONTROL_TAG_STOP) {
+            ctx->stop_seen = get_nanos();
+            break;
+        }
+        ctx->drained++;
+    }
+
+    hive_exit();
+}
+
+static void control_producer(void *args, const hive_spawn_info *siblings,
+                             size_t sibling_count) {
+    (void)siblings;
+    (void)sibling_count;
+    control_ctx *ctx = (control_ctx *)args;
+    uint8_t buffer[CONTROL_MSG_SIZE];
+    memset(buffer, 0xCC, sizeof(buffer));
+
+    // Worker does not run until we yield, so the backlog builds up fully
+    for (size_t i = 0; i < ctx->depth; i++) {
+        hive_ipc_notify(ctx->worker, CONTROL_TAG_DATA, buffer, sizeof(buffer));
+    }
+
+    ctx->stop_sent = get_nanos();
+    if (ctx->urgent) {
+        hive_ipc_notify_urgent(ctx->worker, CONTROL_TAG_STOP, NULL, 0);
+    } else {
+        hive_ipc_notify(ctx->worker, CONTROL_TAG_STOP, NULL, 0);
+    }
+
+    hive_exit();
+}
+
+static void bench_control_run(size_t depth, bool urgent) {
+    control_ctx ctx = {.urgent = urgent, .depth = depth};
+
+    actor_id producer;
+    hive_spawn(control_worker, NULL, &ctx, NULL, &ctx.worker);
+    hive_spawn(control_producer, NULL, &ctx, NULL, &producer);
+    hive_run();
+
+    printf("  %-8s stop: %10lu ns, %5zu data messages drained first\n",
+           urgent ? "urgent" : "ordinary",
+           (unsigned long)(ctx.stop_seen - ctx.stop_sent), ctx.drained);
+}
+
+static void bench_control(void) __attribute__((unused));
+static void bench_control(void) {
+    printf("Control-Plane Latency\n");
+    printf("---------------------\n");
+
+    // Deepest backlog the pools allow (data + stop message)
+    size_t depth = CONTROL_TARGET_DEPTH;
+    if (depth > HIVE_MAILBOX_ENTRY_POOL_SIZE - 1) {
+        depth = HIVE_MAILBOX_ENTRY_POOL_SIZE - 1;
+    }
+    if (depth > HIVE_MESSAGE_DATA_POOL_SIZE - 1) {
+        depth = HIVE_MESSAGE_DATA_POOL_SIZE - 1;
+    }
+    printf("  (%zu-deep mailbox of %d byte messages", depth, CONTROL_MSG_SIZE);
+    if (depth < CONTROL_TARGET_DEPTH) {
+        printf("; raise pool sizes for %d", CONTROL_TARGET_DEPTH);
+    }
+    printf(")\n\n");
+
+    bench_control_run(depth, false);
+    bench_control_run(depth, true);
+
+    printf("\n");
+}
+
+// ============================================================================
+// 10. Timer Benchmark
+// ============================================================================
+
+#define TIMER_OPS 10000
+#define TIMER_BATCH 32 // Timers outstanding at once (within the entry pool)
+#define TIMER_OUTSTANDING 10000
+
+typedef struct {
+    actor_id partner;
+    bool timeout; // Receive with a (never expiring) timeout
+    uint64_t count;
+    uint64_t elapsed;
+} timer_ctx;
+
+static void timer_churn_actor(void *args, const hive_spawn_info *siblings,
+                              size_t sibling_count) {
+    (void)siblings;
+    (void)sibling_count;
+    timer_ctx *ctx = (timer_ctx *)args;
+    timer_id ids[TIMER_BATCH];
+    size_t batch = TIMER_BATCH;
+    if (batch > HIVE_TIMER_ENTRY_POOL_SIZE / 2) {
+        batch = HIVE_TIMER_ENTRY_POOL_SIZE / 2;
+    }
+
+    uint64_t start = get_nanos();
+    for (uint64_t done = 0; done < TIMER_OPS; done += batch) {
+        // Spread deadlines so create/cancel hit different heap positions
+        for (size_t i = 0; i < batch; i++) {
+            hive_timer_after(1000000 + (uint32_t)((i * 7919) % 1000), &ids[i]);
+        }
+        for (size_t i = 0; i < batch; i++) {
+            hive_timer_cancel(ids[i]);
+        }
+        ctx->count += batch;
+    }
+    ctx->elapsed = get_nanos() - start;
+
+    hive_exit();
+}
+
+// Cancel latency with many timers outstanding (timeout-per-connection load)
+static void timer_cancel_actor(void *args, const hive_spawn_info *siblings,
+                               size_t sibling_count) {
+    (void)siblings;
+    (void)sibling_count;
+    timer_ctx *ctx = (timer_ctx *)args;
+    size_t n = (size_t)ctx->count;
+    timer_id *ids = malloc(n * sizeof(timer_id));
+
+    for (size_t i = 0; i < n; i++) {
+        hive_timer_after(10000000 + (uint32_t)((i * 7919) % 100000), &ids[i]);
+    }
+
+    // Cancel in a scattered order (stride coprime with n)
+    size_t stride = 7;
+    while (n % stride == 0) {
+        stride += 2;
+    }
+    uint64_t start = get_nanos();
+    for (size_t i = 0, j = 0; i < n; i++, j = (j + stride) % n) {
+        hive_timer_cancel(ids[j]);
+    }
+    ctx->elapsed = get_nanos() - start;
+
+    free(ids);
+    hive_exit();
+}
+
+static void timer_ping_actor(void *args, const hive_spawn_info *siblings,
+                             size_t sibling_count) {
+    (void)siblings;
+    (void)sibling_count;
+    timer_ctx *ctx = (timer_ctx *)args;
+    int32_t timeout = ctx->timeout ? 1000 : -1;
+
+    uint64_t start = get_nanos();
+    for (uint64_t i = 0; i < ITERATIONS; i++) {
+        hive_ipc_notify(ctx->partner, 0, NULL, 0);
+        hive_message msg;
+        hive_ipc_recv(&msg, timeout);
+    }
+    ctx->elapsed = get_nanos() - start;
+    ctx->count = ITERATIONS;
+
+    hive_exit();
+}
+
+static void timer_pong_actor(void *args, const hive_spawn_info *siblings,
+                             size_t sibling_count) {
+    (void)siblings;
+    (void)sibling_count;
+    timer_ctx *ctx = (timer_ctx *)args;
+    int32_t timeout = ctx->timeout ? 1000 : -1;
+
+    for (uint64_t i = 0; i < ITERATIONS; i++) {
+        hive_message msg;
+        hive_ipc_recv(&msg, timeout);
+        hive_ipc_notify(msg.sender, 0, NULL, 0);
+    }
+
+    hive_exit();
+}
+
+static void bench_recv_timeout(bool timeout) {
+    timer_ctx ping = {.timeout = timeout};
+    timer_ctx pong = {.timeout = timeout};
+
+    actor_id pong_id;
+    actor_id ping_id;
+    hive_spawn(timer_pong_actor, NULL, &pong, NULL, &pong_id);
+    ping.partner = pong_id;
+    hive_spawn(timer_ping_actor, NULL, &ping, NULL, &ping_id);
+    hive_run();
+
+    printf("  %-24s %6lu ns/round trip\n",
+           timeout ? "recv(1000ms timeout):" : "recv(no timeout):",
+           (unsigned long)(ping.elapsed / ping.count));
+}
+
+static void bench_timer(void) __attribute__((unused));
+static void bench_timer(void) {
+    printf("Timers\n");
+    printf("------\n");
+
+    timer_ctx churn = {0};
+    actor_id churn_id;
+    hive_spawn(timer_churn_actor, NULL, &churn, NULL, &churn_id);
+    hive_run();
+    printf("  %-24s %6lu ns/timer  (%.2f M timers/sec)\n",
+           "create + cancel:", (unsigned long)(churn.elapsed / churn.count),
+           (double)churn.count / ((double)churn.elapsed / BILLION) /
+               1000000.0);
+
+    // Outstanding timers the pool allows (others may hold a few)
+    timer_ctx cancel = {.count = TIMER_OUTSTANDING};
+    if (cancel.count > HIVE_TIMER_ENTRY_POOL_SIZE - 4) {
+        cancel.count = HIVE_TIMER_ENTRY_POOL_SIZE - 4;
+    }
+    actor_id cancel_id;
+    actor_config cancel_cfg = HIVE_ACTOR_CONFIG_DEFAULT;
+    cancel_cfg.malloc_stack = true;
+    hive_spawn(timer_cancel_actor, NULL, &cancel, &cancel_cfg, &cancel_id);
+    hive_run();
+    printf("  %-24s %6lu ns/cancel (%lu timers outstanding",
+           "cancel:", (unsigned long)(cancel.elapsed / cancel.count),
+           (unsigned long)cancel.count);
+    if (cancel.count < TIMER_OUTSTANDING) {
+        printf("; raise HIVE_TIMER_ENTRY_POOL_SIZE for %d", TIMER_OUTSTANDING);
+    }
+    printf(")\n");
+
+    bench_recv_timeout(false);
+    bench_recv_timeout(true);
+
+    printf("\n");
+}
+
+// ============================================================================
+// 11. Periodic Jitter Benchmark
+// ============================================================================
+
+#define JITTER_INTERVAL_US 1000 // 1 kHz control loop
+#define JITTER_TICKS 1000
+#define JITTER_LOAD_ACTORS 4
+#define JITTER_LOAD_SLICE_US 50 // Busy time per background slice
+#define JITTER_BUCKETS 7
+
+static const uint32_t s_jitter_bounds[JITTER_BUCKETS - 1] = {10,  20,  50,
+                                                             100, 200, 500};
+
+typedef struct {
+    bool load;
+    volatile bool done;
+    uint64_t histogram[JITTER_BUCKETS];
+    uint64_t missed;
+    hive_timer_stats stats;
+} jitter_ctx;
+
+// Background load: burn CPU in short slices, yielding in between
+static void jitter_load_actor(void *args, const hive_spawn_info *siblings,
+                              size_t sibling_count) {
+    (void)siblings;
+    (void)sibling_count;
+    jitter_ctx *ctx = (jitter_ctx *)args;
+
+    while (!ctx->done) {
+        uint64_t until = hive_get_time() + JITTER_LOAD_SLICE_US;
+        while (hive_get_time() < until) {
+        }
+        hive_yield();
+    }
+
+    hive_exit();
+}
+
+static void jitter_actor(void *args, const hive_spawn_info *siblings,
+                         size_t sibling_count) {
+    (void)siblings;
+    (void)sibling_count;
+    jitter_ctx *ctx = (jitter_ctx *)args;
+
+    uint64_t start = hive_get_time() + JITTER_INTERVAL_US;
+    timer_id timer;
+    hive_timer_every_abs(start, JITTER_INTERVAL_US, &timer);
+
+    // Lateness = receive time - due time on the start + k * interval grid
+    uint64_t period = 0;
+    for (int i = 0; i < JITTER_TICKS; i++) {
+        hive_message msg;
+        hive_ipc_recv_match(HIVE_SENDER_ANY, HIVE_MSG_TIMER, timer, &msg, -1);
+        uint64_t now = hive_get_time();
+        uint32_t missed = hive_timer_missed(&msg);
+        period += missed;
+        ctx->missed += missed;
+
+        uint64_t late = now - (start + period * JITTER_INTERVAL_US);
+        size_t bucket = 0;
+        while (bucket < JITTER_BUCKETS - 1 && late >= s_jitter_bounds[bucket]) {
+            bucket++;
+        }
+        ctx->histogram[bucket]++;
+        period++;
+    }
+
+    hive_timer_get_stats(timer, &ctx->stats);
+    hive_timer_cancel(timer);
+    ctx->done = true;
+    hive_exit();
+}
+
+static void bench_jitter_run(bool load) {
+    jitter_ctx ctx = {.load = load};
+
+    actor_config cfg = HIVE_ACTOR_CONFIG_DEFAULT;
+    cfg.priority = HIVE_PRIORITY_HIGH;
+    actor_id id;
+    hive_spawn(jitter_actor, NULL, &ctx, &cfg, &id);
+    for (int i = 0; load && i < JITTER_LOAD_ACTORS; i++) {
+        hive_spawn(jitter_load_actor, NULL, &ctx, NULL, &id);
+    }
+    hive_run();
+
+    printf("  %s\n", load ? "With background load (4 busy actors):"
+                           : "Idle:");
+    printf("    lateness   ");
+    for (size_t i = 0; i < JITTER_BUCKETS - 1; i++) {
+        printf(" <%-4u", s_jitter_bounds[i]);
+    }
+    printf(" >=%u us\n", s_jitter_bounds[JITTER_BUCKETS - 2]);
+    printf("    ticks      ");
+    for (size_t i = 0; i < JITTER_BUCKETS; i++) {
+        printf(" %-5lu", (unsigned long)ctx.histogram[i]);
+    }
+    printf("\n");
+    printf("    mean %lu us, max %u us, missed %lu periods\n",
+           (unsigned long)(ctx.stats.ticks
+                               ? ctx.stats.total_late_us / ctx.stats.ticks
+                               : 0),
+           ctx.stats.max_late_us, (unsigned long)ctx.missed);
+}
+
+static void bench_jitter(void) __attribute__((unused));
+static void bench_jitter(void) {
+    printf("Periodic Jitter (1 kHz, %d ticks)\n", JITTER_TICKS);
+    printf("---------------------------------\n");
+
+    bench_jitter_run(false);
+    bench_jitter_run(true);
+
+    printf("\n");
+}
+
+// ============================================================================
+// 12. Timer Slack Benchmark
+// ============================================================================
+
+#define SLACK_TIMERS 1000
+#define SLACK_PERIOD_US 100000 // Heartbeat every 100ms
+#define SLACK_US 20000         // 20% slack
+#define SLACK_DURATION_US 1000000
+
+typedef struct {
+    uint32_t slack_us;
+    size_t timers;
+    uint64_t wakeups;
+    uint64_t ticks;
+    uint64_t cpu_ns;
+} slack_ctx;
+
+static uint64_t get_cpu_nanos(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &ts);
+    return (uint64_t)ts.tv_sec * BILLION + (uint64_t)ts.tv_nsec;
+}
+
+static void heartbeat_arm(uint32_t delay_us, uint32_t slack_us) {
+    timer_id id;
+    if (slack_us) {
+        hive_timer_after_slack(delay_us, slack_us, &id);
+    } else {
+        hive_timer_after(delay_us, &id);
+    }
+}
+
+// Heartbeat timers re-armed on every expiry (first deadlines spread evenly
+// over one period); counts how often the actor is woken
+static void slack_actor(void *args, const hive_spawn_info *siblings,
+                        size_t sibling_count) {
+    (void)siblings;
+    (void)sibling_count;
+    slack_ctx *ctx = (slack_ctx *)args;
+
+    uint64_t cpu_start = get_cpu_nanos();
+    uint64_t end = hive_get_time() + SLACK_DURATION_US;
+    for (size_t i = 0; i < ctx->timers; i++) {
+        heartbeat_arm((uint32_t)(SLACK_PERIOD_US * (i + 1) / ctx->timers),
+                      ctx->slack_us);
+    }
+
+    size_t outstanding = ctx->timers;
+    while (outstanding > 0) {
+        hive_message msg;
+        hive_ipc_recv(&msg, -1);
+        ctx->wakeups++;
+
+        // Drain the batch delivered with this wakeup
+        do {
+            ctx->ticks++;
+            if (hive_get_time() < end) {
+                heartbeat_arm(SLACK_PERIOD_US, ctx->slack_us);
+            } else {
+                outstanding--;
+            }
+        } while (HIVE_SUCCEEDED(hive_ipc_recv(&msg, 0)));
+    }
+    ctx->cpu_ns = get_cpu_nanos() - cpu_start;
+
+    hive_exit();
+}
+
+static void bench_slack_run(uint32_t slack_us, size_t timers) {
+    slack_ctx ctx = {.slack_us = slack_us, .timers = timers};
+    actor_id id;
+    hive_spawn(slack_actor, NULL, &ctx, NULL, &id);
+    hive_run();
+
+    printf("  %-24s %6lu wakeups, %6lu ticks, %4lu wakeups/s, "
+           "%5.1f ms CPU\n",
+           slack_us ? "slack 20ms:" : "no slack:", (unsigned long)ctx.wakeups,
+           (unsigned long)ctx.ticks,
+           (unsigned long)(ctx.wakeups * 1000000 / SLACK_DURATION_US),
+           (double)ctx.cpu_ns / 1000000.0);
+}
+
+static void bench_slack(void) __attribute__((unused));
+static void bench_slack(void) {
+    size_t timers = SLACK_TIMERS;
+    if (timers > HIVE_TIMER_ENTRY_POOL_SIZE - 4) {
+        timers = HIVE_TIMER_ENTRY_POOL_SIZE - 4;
+    }
+    printf("Timer Slack (%zu heartbeat timers, 100ms period, 1s)\n", timers);
+    printf("------------------------------------------------------\n");
+    if (timers < SLACK_TIMERS) {
+        printf("  (raise HIVE_TIMER_ENTRY_POOL_SIZE for %d timers)\n",
+               SLACK_TIMERS);
+    }
+
+    bench_slack_run(0, timers);
+    bench_slack_run(SLACK_US, timers);
+
+    printf("\n");
+}
+
+// ============================================================================
+// 13. Timer Wake Precision Benchmark
+// ============================================================================
+
+#define WAKE_SAMPLES 500
+#define WAKE_SPIN_US 200 // Spin threshold for the high-precision runs
+
+static const uint32_t s_wake_delays[] = {50, 100, 250, 1000};
+
+typedef struct {
+    uint32_t delay_us;
+    uint32_t late_ns[WAKE_SAMPLES];
+} wake_ctx;
+
+static int compare_u32(const void *a, const void *b) {
+    uint32_t x = *(const uint32_t *)a;
+    uint32_t y = *(const uint32_t *)b;
+    return (x > y) - (x < y);
+}
+
+// Wake error of hive_sleep(): time past the requested delay
+static void wake_actor(void *args, const hive_spawn_info *siblings,
+                       size_t sibling_count) {
+    (void)siblings;
+    (void)sibling_count;
+    wake_ctx *ctx = (wake_ctx *)args;
+
+    for (int i = 0; i < WAKE_SAMPLES; i++) {
+        uint64_t start = get_nanos();
+        hive_sleep(ctx->delay_us);
+        uint64_t late = get_nanos() - start - ctx->delay_us * 1000ULL;
+        ctx->late_ns[i] = late > UINT32_MAX ? UINT32_MAX : (uint32_t)late;
+    }
+
+    hive_exit();
+}
+
+static void bench_wake_run(uint32_t delay_us, uint32_t spin_us) {
+    static wake_ctx ctx;
+    ctx.delay_us = delay_us;
+
+    hive_timer_set_spin(spin_us);
+    actor_id id;
+    hive_spawn(wake_actor, NULL, &ctx, NULL, &id);
+    hive_run();
+    hive_timer_set_spin(HIVE_TIMER_SPIN_US);
+
+    qsort(ctx.late_ns, WAKE_SAMPLES, sizeof(ctx.late_ns[0]), compare_u32);
+    char label[32];
+    snprintf(label, sizeof(label), "%4u us, %s:", delay_us,
+             spin_us ? "spin" : "epoll");
+    printf("  %-18s p50 %6.1f  p90 %6.1f  p99 %6.1f  max %7.1f us\n", label,
+           ctx.late_ns[WAKE_SAMPLES / 2] / 1000.0,
+           ctx.late_ns[WAKE_SAMPLES * 90 / 100] / 1000.0,
+           ctx.late_ns[WAKE_SAMPLES * 99 / 100] / 1000.0,
+           ctx.late_ns[WAKE_SAMPLES - 1] / 1000.0);
+}
+
+static void bench_wake(void) __attribute__((unused));
+static void bench_wake(void) {
+    printf("Timer Wake Precision (hive_sleep wake error, %d samples, "
+           "spin %dus)\n",
+           WAKE_SAMPLES, WAKE_SPIN_US);
+    printf("-------------------------------------------------------------"
+           "----\n");
+
+    for (size_t i = 0; i < sizeof(s_wake_delays) / sizeof(s_wake_delays[0]);
+         i++) {
+        bench_wake_run(s_wake_delays[i], 0);
+        bench_wake_run(s_wake_delays[i], WAKE_SPIN_US);
+    }
+
+    printf("\n");
+}
+
+// ============================================================================
+// 14. Time Read Benchmark
+// ============================================================================
+
+#define TIME_READS 10000000
+
+static uint64_t read_clock_gettime(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000 + (uint64_t)ts.tv_nsec / 1000;
+}
+
+static uint64_t read_gettimeofday(void) {
+    struct timeval tv;
+    gettimeofday(&tv, NULL);
+    return (uint64_t)tv.tv_sec * 1000000 + (uint64_t)tv.tv_usec;
+}
+
+static void bench_time_read_run(uint64_t (*read)(void), const char *label) {
+    volatile uint64_t sink = 0;
+    uint64_t start = get_nanos();
+    for (int i = 0; i < TIME_READS; i++) {
+        sink += read();
+    }
+    uint64_t elapsed = get_nanos() - start;
+    (void)sink;
+    printf("  %-28s %6.1f ns/read\n", label, (double)elapsed / TIME_READS);
+}
+
+static void bench_time_read(void) __attribute__((unused));
+static void bench_time_read(void) {
+    printf("Time Read Cost (%d reads)\n", TIME_READS);
+    printf("--------------------------------------------------\n");
+
+    // Let the TSC calibration window pass (earlier benchmarks usually have)
+    uint64_t calibrated = hive_get_time() + 20000;
+    while (hive_get_time() < calibrated) {
+    }
+
+    bench_time_read_run(read_gettimeofday, "gettimeofday (old bus):");
+    bench_time_read_run(read_clock_gettime, "clock_gettime MONOTONIC:");
+    bench_time_read_run(hive_get_time, hive_clock_is_tsc()
+                                           ? "hive_get_time (TSC):"
+                                           : "hive_get_time (vDSO):");
+    hive_time_coarse_invalidate();
+    bench_time_read_run(hive_get_time_coarse, "hive_get_time_coarse:");
+
+    printf("\n");
+}
+
+// ============================================================================
+// 15. Timer Wheel Benchmark
+// ============================================================================
+
+// Tick processing in the STM32 timer backend, run on the host: the old
+// unsorted list checked every timer on every 1ms tick, the wheel touches
+// only the slots that come due. Periodic nodes are re-filed on expiry like
+// backend timers. The sparse case counts the wakeups a tickless idle needs
+// (jumping to hive_timer_wheel_next()) instead of one per tick.
+
+#define WHEEL_TIMERS 64
+#define WHEEL_TICKS 1000000
+
+static uint32_t wheel_period(int i) {
+    return 4 + (uint32_t)i * 37; // 4ms (pilot loop) up to ~2.3s
+}
+
+static void bench_wheel_list(void) {
+    static uint32_t expiry[WHEEL_TIMERS];
+    for (int i = 0; i < WHEEL_TIMERS; i++) {
+        expiry[i] = wheel_period(i);
+    }
+    volatile uint64_t fired = 0;
+    uint64_t start = get_nanos();
+    for (uint32_t now = 1; now <= WHEEL_TICKS; now++) {
+        for (int i = 0; i < WHEEL_TIMERS; i++) {
+            if ((int32_t)(expiry[i] - now) <= 0) {
+                expiry[i] = now + wheel_period(i);
+                fired++;
+            }
+        }
+    }
+    uint64_t elapsed = get_nanos() - start;
+    printf("  Unsorted list walk:     %6.1f ns/tick (%lu expiries)\n",
+           (double)elapsed / WHEEL_TICKS, (unsigned long)fired);
+}
+
+static void bench_wheel_ticks(void) {
+    static hive_timer_wheel wheel;
+    static hive_timer_wheel_node nodes[WHEEL_TIMERS];
+    hive_timer_wheel_init(&wheel, 0);
+    for (int i = 0; i < WHEEL_TIMERS; i++) {
+        hive_timer_wheel_insert(&wheel, &nodes[i], wheel_period(i));
+    }
+    uint64_t fired = 0;
+    uint64_t start = get_nanos();
+    for (uint32_t now = 1; now <= WHEEL_TICKS; now++) {
+        hive_timer_wheel_advance(&wheel, now);
+        hive_timer_wheel_node *node;
+        while ((node = hive_timer_wheel_pop(&wheel))) {
+            hive_timer_wheel_insert(&wheel, node,
+                                    now + wheel_period((int)(node - nodes)));
+            fired++;
+        }
+    }
+    uint64_t elapsed = get_nanos() - start;
+    printf("  Timer wheel:            %6.1f ns/tick (%lu expiries)\n",
+           (double)elapsed / WHEEL_TICKS, (unsigned long)fired);
+}
+
+// 8 loose timers (100ms to 10s): tickless wakeups versus 1ms ticks
+static void bench_wheel_tickless(void) {
+    static hive_timer_wheel wheel;
+    static hive_timer_wheel_node nodes[8];
+    static const uint32_t periods[8] = {100,  250,  500,  1000,
+                                        2000, 3000, 5000, 10000};
+    hive_timer_wheel_init(&wheel, 0);
+    for (int i = 0; i < 8; i++) {
+        hive_timer_wheel_insert(&wheel, &nodes[i], periods[i]);
+    }
+    uint64_t wakeups = 0;
+    uint64_t fired = 0;
+    uint32_t now = 0;
+    while (now < WHEEL_TICKS) {
+        hive_timer_wheel_next(&wheel, &now);
+        hive_timer_wheel_advance(&wheel, now);
+        hive_timer_wheel_node *node;
+        while ((node = hive_timer_wheel_pop(&wheel))) {
+            hive_timer_wheel_insert(&wheel, node,
+                                    now + periods[node - nodes]);
+            fired++;
+        }
+        wakeups++;
+    }
+    printf("  Tickless, 8 timers:     %lu wakeups for %lu expiries "
+           "(%d periodic ticks)\n",
+           (unsigned long)wakeups, (unsigned long)fired, WHEEL_TICKS);
+}
+
+static void bench_wheel(void) __attribute__((unused));
+static void bench_wheel(void) {
+    printf("Timer Wheel (%d timers, %d ticks)\n", WHEEL_TIMERS, WHEEL_TICKS);
+    printf("--------------------------------------------------\n");
+
+    bench_wheel_list();
+    bench_wheel_ticks();
+    bench_wheel_tickless();
+
+    printf("\n");
+}
+
+// ============================================================================
+// 16. Partial-Read Deadline Benchmark
+// ============================================================================
+
+// A reader collects fragments for a fixed budget while a producer sends
+// them 1ms apart for longer than that. With a relative timeout per call
+// every fragment restarts the clock, so the loop overruns its budget; one
+// absolute deadline (hive_ipc_recv_until) ends it on time.
+
+#define FRAG_ROUNDS 50
+#define FRAG_COUNT 8       // Fragments per round
+#define FRAG_GAP_US 1000   // Producer spacing
+#define FRAG_BUDGET_US 4500 // Reader budget per round
+#define FRAG_GO 1
+#define FRAG_DATA 2
+#define FRAG_END 3
+
+typedef struct {
+    actor_id reader;
+    bool use_deadline;
+    uint64_t total_over_us;
+    uint64_t max_over_us;
+    uint32_t fragments;
+} frag_ctx;
+
+static void frag_producer(void *args, const hive_spawn_info *siblings,
+                          size_t sibling_count) {
+    (void)siblings;
+    (void)sibling_count;
+    frag_ctx *ctx = (frag_ctx *)args;
+    hive_message msg;
+
+    for (int round = 0; round < FRAG_ROUNDS; round++) {
+        hive_ipc_recv_match(ctx->reader, HIVE_MSG_NOTIFY, FRAG_GO, &msg, -1);
+        for (int i = 0; i < FRAG_COUNT; i++) {
+            hive_sleep(FRAG_GAP_US);
+            hive_ipc_notify(ctx->reader, FRAG_DATA, NULL, 0);
+        }
+        hive_ipc_notify(ctx->reader, FRAG_END, NULL, 0);
+    }
+    hive_exit();
+}
+
+static void frag_reader(void *args, const hive_spawn_info *siblings,
+                        size_t sibling_count) {
+    (void)siblings;
+    (void)sibling_count;
+    frag_ctx *ctx = (frag_ctx *)args;
+    ctx->reader = hive_self();
+    actor_id producer;
+    hive_spawn(frag_producer, NULL, ctx, NULL, &producer);
+    hive_message msg;
+
+    for (int round = 0; round < FRAG_ROUNDS; round++) {
+        hive_ipc_notify(producer, FRAG_GO, NULL, 0);
+        uint64_t deadline = hive_get_time() + FRAG_BUDGET_US;
+        hive_status s;
+        do {
+            s = ctx->use_deadline
+                    ? hive_ipc_recv_match_until(producer, HIVE_MSG_NOTIFY,
+                                                FRAG_DATA, &msg, deadline)
+                    : hive_ipc_recv_match(producer, HIVE_MSG_NOTIFY,
+                                          FRAG_DATA, &msg,
+                                          FRAG_BUDGET_US / 1000);
+            if (HIVE_SUCCEEDED(s)) {
+                ctx->fragments++;
+            }
+        } while (HIVE_SUCCEEDED(s));
+        uint64_t now = hive_get_time();
+        uint64_t over = now > deadline ? now - deadline : 0;
+        ctx->total_over_us += over;
+        if (over > ctx->max_over_us) {
+            ctx->max_over_us = over;
+        }
+
+        // Discard what the round left behind
+        hive_ipc_recv_match(producer, HIVE_MSG_NOTIFY, FRAG_END, &msg, -1);
+        while (HIVE_SUCCEEDED(hive_ipc_recv_match(producer, HIVE_MSG_NOTIFY,
+                                                  FRAG_DATA, &msg, 0))) {
+        }
+    }
+    hive_exit();
+}
+
+static void bench_frag_run(bool use_deadline) {
+    static frag_ctx ctx;
+    memset(&ctx, 0, sizeof(ctx));
+    ctx.use_deadline = use_deadline;
+
+    actor_id id;
+    hive_spawn(frag_reader, NULL, &ctx, NULL, &id);
+    hive_run();
+
+    printf("  %-24s %4.1f fragments/round, overrun mean %6.0f  max %6lu us\n",
+           use_deadline ? "Absolute deadline:" : "Relative timeout/call:",
+           (double)ctx.fragments / FRAG_ROUNDS,
+           (double)ctx.total_over_us / FRAG_ROUNDS,
+           (unsigned long)ctx.max_over_us);
+}
+
+// Timed-wait bookkeeping: what a blocking call with a timeout adds to the
+// block itself, a timer created and cancelled per call (how timeouts used
+// to work) against arming and cancelling the actor's deadline slot
+#define WAIT_ROUNDS 1000000
+
+static void wait_cost_actor(void *args, const hive_spawn_info *siblings,
+                            size_t sibling_count) {
+    (void)args;
+    (void)siblings;
+    (void)sibling_count;
+    actor *self = hive_actor_current();
+
+    uint64_t start = get_nanos();
+    for (int i = 0; i < WAIT_ROUNDS; i++) {
+        timer_id timer;
+        hive_timer_after(1000000, &timer);
+        hive_timer_cancel(timer);
+    }
+    uint64_t timer_ns = get_nanos() - start;
+
+    start = get_nanos();
+    for (int i = 0; i < WAIT_ROUNDS; i++) {
+        hive_timer_deadline_arm(self, hive_get_time() + 1000000);
+        hive_timer_deadline_cancel(self);
+    }
+    uint64_t deadline_ns = get_nanos() - start;
+
+    printf("  %-24s %6.1f ns/wait (one timer pool entry each)\n",
+           "Timer per wait:", (double)timer_ns / WAIT_ROUNDS);
+    printf("  %-24s %6.1f ns/wait (no allocation)\n", "Deadline slot:",
+           (double)deadline_ns / WAIT_ROUNDS);
+    hive_exit();
+}
+
+static void bench_frag(void) __attribute__((unused));
+static void bench_frag(void) {
+    printf("Partial-Read Deadline (%d rounds, %d fragments %dus apart, "
+           "%dus budget)\n",
+           FRAG_ROUNDS, FRAG_COUNT, FRAG_GAP_US, FRAG_BUDGET_US);
+    printf("-------------------------------------------------------------"
+           "----\n");
+
+    bench_frag_run(false);
+    bench_frag_run(true);
+
+    actor_id id;
+    hive_spawn(wait_cost_actor, NULL, NULL, NULL, &id);
+    hive_run();
+
+    printf("\n");
+}
+
+// ============================================================================
+// 17. Event-Driven Simulation Benchmark
+// ============================================================================
+
+// Pilot-like actor graph with a stub HAL: a 250 Hz sensor feeds an
+// estimator, whose state fans out to six control stages chained by buses,
+// while a flight manager waits on one long mission timer. Measures how many
+// simulated seconds run per wall-clock second when driven by fixed-step
+// hive_advance_time() loops versus hive_run_until_idle_sim().
+// Must run last: simulation mode cannot be left once entered.
+
+#define SIM_SENSOR_US 4000         // Sensor period (pilot TIME_STEP_MS)
+#define SIM_MISSION_US 60000000ULL // 60 simulated seconds
+#define SIM_STAGES 7               // Estimator + waypoint + 4 control + motor
+
+typedef struct {
+    uint32_t seq;
+    bool stop; // Last sample: every stage forwards it and exits
+    float values[6];
+} sim_sample;
+
+typedef struct {
+    bus_id in;
+    bus_id out; // BUS_ID_INVALID for the motor stage
+} sim_stage_args;
+
+typedef struct {
+    bus_id buses[SIM_STAGES];
+    sim_stage_args stages[SIM_STAGES];
+    bool mission_over;
+    int alive; // Graph actors that have not exited yet
+    uint64_t samples;
+    uint64_t motor_writes;
+} sim_ctx;
+
+static sim_ctx s_sim;
+
+// Stub HAL: no physics, just enough work to not be optimized away
+static void sim_hal_read_sensors(sim_sample *sample) {
+    for (int i = 0; i < 6; i++) {
+        sample->values[i] = (float)(sample->seq % 100) * 0.01f * (float)i;
+    }
+}
+
+static void sim_hal_write_motors(const sim_sample *sample) {
+    (void)sample;
+    s_sim.motor_writes++;
+}
+
+static void sim_sensor_actor(void *args, const hive_spawn_info *siblings,
+                             size_t sibling_count) {
+    (void)args;
+    (void)siblings;
+    (void)sibling_count;
+
+    timer_id timer;
+    hive_timer_every(SIM_SENSOR_US, &timer);
+
+    sim_sample sample = {0};
+    while (!sample.stop) {
+        hive_message msg;
+        hive_ipc_recv_match(HIVE_SENDER_ANY, HIVE_MSG_TIMER, timer, &msg, -1);
+        sample.seq++;
+        sample.stop = s_sim.mission_over;
+        sim_hal_read_sensors(&sample);
+        hive_bus_publish(s_sim.buses[0], &sample, sizeof(sample));
+        s_sim.samples++;
+    }
+
+    hive_timer_cancel(timer);
+    s_sim.alive--;
+    hive_exit();
+}
+
+static void sim_stage_actor(void *args, const hive_spawn_info *siblings,
+                            size_t sibling_count) {
+    (void)siblings;
+    (void)sibling_count;
+    sim_stage_args *stage = (sim_stage_args *)args;
+
+    hive_bus_subscribe(stage->in);
+
+    sim_sample sample = {0};
+    while (!sample.stop) {
+        size_t len;
+        hive_bus_read_wait(stage->in, &sample, sizeof(sample), &len, -1);
+        for (int i = 0; i < 6; i++) {
+            sample.values[i] = sample.values[i] * 0.9f + 0.1f;
+        }
+        if (stage->out != BUS_ID_INVALID) {
+            hive_bus_publish(stage->out, &sample, sizeof(sample));
+        } else {
+            sim_hal_write_motors(&sample);
+        }
+    }
+
+    hive_bus_unsubscribe(stage->in);
+    s_sim.alive--;
+    hive_exit();
+}
+
+static void sim_flight_manager_actor(void *args,
+                                     const hive_spawn_info *siblings,
+                                     size_t sibling_count) {
+    (void)args;
+    (void)siblings;
+    (void)sibling_count;
+
+    // Mission timer: longer than a uint32_t delay allows, so chain sleeps
+    for (uint64_t left = SIM_MISSION_US; left > 0;) {
+        uint32_t step = left > 1000000 ? 1000000 : (uint32_t)left;
+        hive_sleep(step);
+        left -= step;
+    }
+    s_sim.mission_over = true;
+    s_sim.alive--;
+    hive_exit();
+}
+
+static void sim_spawn_graph(void) {
+    hive_bus_config cfg = HIVE_BUS_CONFIG_DEFAULT;
+    cfg.max_entries = 1;
+    cfg.max_entry_size = sizeof(sim_sample);
+
+    memset(&s_sim, 0, sizeof(s_sim));
+    for (int i = 0; i < SIM_STAGES; i++) {
+        hive_bus_create(&cfg, &s_sim.buses[i]);
+    }
+
+    // Bus 0: sensor, 1: state; estimator and waypoint/altitude/position
+    // read state, attitude and rate follow the setpoint chain into motor
+    static const int in[SIM_STAGES] = {0, 1, 1, 1, 2, 3, 4};
+    static const int out[SIM_STAGES] = {1, 5, 6, 2, 3, 4, -1};
+    for (int i = 0; i < SIM_STAGES; i++) {
+        s_sim.stages[i].in = s_sim.buses[in[i]];
+        s_sim.stages[i].out = out[i] < 0 ? BUS_ID_INVALID : s_sim.buses[out[i]];
+    }
+
+    actor_config cfg_actor = HIVE_ACTOR_CONFIG_DEFAULT;
+    cfg_actor.priority = HIVE_PRIORITY_CRITICAL;
+    actor_id id;
+    for (int i = 0; i < SIM_STAGES; i++) {
+        hive_spawn(sim_stage_actor, NULL, &s_sim.stages[i], &cfg_actor, &id);
+    }
+    hive_spawn(sim_sensor_actor, NULL, NULL, &cfg_actor, &id);
+    hive_spawn(sim_flight_manager_actor, NULL, NULL, &cfg_actor, &id);
+    s_sim.alive = SIM_STAGES + 2;
+}
+
+static void sim_destroy_graph(void) {
+    for (int i = 0; i < SIM_STAGES; i++) {
+        hive_bus_destroy(s_sim.buses[i]);
+    }
+}
+
+static void bench_sim_run(uint32_t step_us) {
+    sim_spawn_graph();
+    uint64_t sim_start = hive_get_time();
+    uint64_t start = get_nanos();
+
+    if (step_us) {
+        hive_run_until_blocked();
+        while (s_sim.alive > 0) {
+            hive_advance_time(step_us);
+            hive_run_until_blocked();
+        }
+    } else {
+        hive_run_until_idle_sim(UINT64_MAX);
+    }
+
+    uint64_t wall_ns = get_nanos() - start;
+    double sim_s = (double)(hive_get_time() - sim_start) / 1e6;
+    double wall_s = (double)wall_ns / 1e9;
+    sim_destroy_graph();
+
+    char label[32];
+    if (step_us) {
+        snprintf(label, sizeof(label), "fixed step %ums:", step_us / 1000);
+    } else {
+        snprintf(label, sizeof(label), "run_until_idle_sim:");
+    }
+    printf("  %-22s %6.1f sim s in %6.1f ms wall, %8.0f sim-s/wall-s "
+           "(%lu samples)\n",
+           label, sim_s, wall_s * 1000.0, sim_s / wall_s,
+           (unsigned long)s_sim.samples);
+}
+
+static void bench_sim(void) __attribute__((unused));
+static void bench_sim(void) {
+    printf("Event-Driven Simulation (9 actors, 250 Hz sensor, 60 s)\n");
+    printf("--------------------------------------------------------\n");
+
+    hive_advance_time(0); // Enter simulation mode (irreversible)
+
+    bench_sim_run(SIM_SENSOR_US);
+    bench_sim_run(1000);
+    bench_sim_run(0);
+
+    printf("\n");
+}
+
+// ============================================================================
+// Main
+// ============================================================================
+
+int main(void) {
+    printf("\n");
+    printf("=================================================\n");
+    printf("  Actor Runtime Benchmark Suite\n");
+    printf("=================================================\n");
+    printf("\n");
+    printf("Configuration:\n");
+    printf("  HIVE_MAX_ACTORS:               %d\n", HIVE_MAX_ACTORS);
+    printf("  HIVE_MAILBOX_ENTRY_POOL_SIZE:  %d\n",
+           HIVE_MAILBOX_ENTRY_POOL_SIZE);
+    printf("  HIVE_MESSAGE_DATA_POOL_SIZE:   %d\n",
+           HIVE_MESSAGE_DATA_POOL_SIZE);
+    printf("  HIVE_DEFAULT_STACK_SIZE:       %d\n", HIVE_DEFAULT_STACK_SIZE);
+    printf("  Iterations:                  %d\n", ITERATIONS);
+    printf("\n");
+
+    printf("Initializing runtime...\n");
+    fflush(stdout);
+
+    // Initialize runtime
+    hive_status status = hive_init();
+    if (HIVE_FAILED(status)) {
+        fprintf(stderr, "Failed to initialize runtime: %s\n",
+                status.msg ? status.msg : "unknown error");
+        return 1;
+    }
+
+    // Run benchmarks (all in single runtime session)
+    printf("Starting context switch benchmark...\n");
+    fflush(stdout);
+    bench_context_switch();
+
+    printf("Starting IPC benchmark...\n");
+    fflush(stdout);
+    bench_ipc();
+
+    printf("Starting pool allocation benchmark...\n");
+    fflush(stdout);
+    bench_pool_allocation();
+
+    printf("Starting actor spawn benchmark...\n");
+    fflush(stdout);
+    bench_actor_spawn();
+
+    printf("Starting bus benchmark...\n");
+    fflush(stdout);
+    bench_bus();
+
+    printf("Starting key/value server benchmark...\n");
+    fflush(stdout);
+    bench_kv_server();
+
+    printf("Starting routing chain benchmark...\n");
+    fflush(stdout);
+    bench_routing();
+
+    printf("Starting multicast fan-out benchmark...\n");
+    fflush(stdout);
+    bench_fanout();
+
+    printf("Starting control-plane latency benchmark...\n");
+    fflush(stdout);
+    bench_control();
+
+    printf("Starting timer benchmark...\n");
+    fflush(stdout);
+    bench_timer();
+
+    printf("Starting periodic jitter benchmark...\n");
+    fflush(stdout);
+    bench_jitter();
+
+    printf("Starting timer slack benchmark...\n");
+    fflush(stdout);
+    bench_slack();
+
+    printf("Starting timer wake precision benchmark...\n");
+    fflush(stdout);
+    bench_wake();
+
+    printf("Starting time read benchmark...\n");
+    fflush(stdout);
+    bench_time_read();
+
+    printf("Starting timer wheel benchmark...\n");
+    fflush(stdout);
+    bench_wheel();
+
+    printf("Starting partial-read deadline benchmark...\n");
+    fflush(stdout);
+    bench_frag();
+
+    printf("Starting event-driven simulation benchmark...\n");
+    fflush(stdout);
+    bench_sim();
 
     hive_cleanup();
 
@@ -23,6 +23,7 @@ HIVE_CFLAGS += -DHIVE_TIMER_ENTRY_POOL_SIZE=8     # flight_manager uses 3 timers
 # Bus configuration
 HIVE_CFLAGS += -DHIVE_MAX_BUS_SUBSCRIBERS=6
 HIVE_CFLAGS += -DHIVE_MAX_BUS_ENTRIES=4
+HIVE_CFLAGS += -DHIVE_BUS_ARENA_SIZE=2048  # 7 buses * (32 + 128 + 16 header) bytes
 
 # Message size - enough for sensor/state structs
 HIVE_CFLAGS += -DHIVE_MAX_MESSAGE_SIZE=128
@@ -3,6 +3,7 @@
 
 #include "hive_types.h"
 #include "hive_context.h"
+#include "hive_timer.h"
 
 // Actor states
 typedef enum {
@@ -15,6 +16,7 @@ typedef enum {
 // Mailbox entry (linked list)
 typedef struct mailbox_entry {
     actor_id sender;
+    actor_id retained_by; // Actor keeping it via hive_msg_retain(), 0 = none
     size_t len;
     void *data;
     struct mailbox_entry *next;
@@ -22,12 +24,23 @@ typedef struct mailbox_entry {
 } mailbox_entry;
 
 // Mailbox
+// Urgent entries form a FIFO prefix of the list ending at urgent_tail, so
+// every scan from head sees them before ordinary entries.
 typedef struct {
     mailbox_entry *head;
     mailbox_entry *tail;
+    mailbox_entry *urgent_tail; // Last urgent entry, NULL if none
     size_t count;
 } mailbox;
 
+// Receive filter compiled for matching against a raw message header:
+// (header & mask) == value covers class and tag in one compare
+typedef struct {
+    actor_id sender; // HIVE_SENDER_ANY for any sender
+    uint32_t mask;   // Header bits that must equal value
+    uint32_t value;
+} hive_compiled_filter;
+
 // Link entry (bidirectional relationship)
 typedef struct link_entry {
     actor_id target;
@@ -67,13 +80,18 @@ typedef struct {
     // Active message (for proper cleanup)
     mailbox_entry *active_msg;
 
-    // For selective receive: filter array to match against (multi-pattern)
-    const hive_recv_filter *recv_filters; // NULL = no filter active
-    size_t recv_filter_count;             // Number of filters in array
+    // Messages kept alive past the next receive by hive_msg_retain()
+    mailbox_entry *retained; // Doubly-linked list (reuses next/prev)
+
+    // For hive_select: IPC filters compiled when the actor blocks, checked
+    // on every enqueue to decide whether to wake it
+    const hive_compiled_filter *wake_filters;
+    size_t wake_filter_count;
 
     // For hive_select: multi-source wait (IPC + bus)
     const hive_select_source *select_sources; // NULL = not in select
     size_t select_source_count;               // Number of sources in array
+    uint64_t select_wake_us; // Wait deadline slot expiry while in select
 
     // For I/O completion results
     hive_status io_status;
@@ -83,6 +101,11 @@ typedef struct {
     // Links and monitors
     link_entry *links;            // Bidirectional links to other actors
     monitor_entry *monitors;      // Actors we are monitoring (unidirectional)
+
+    // Bus subscriptions (list owned by hive_bus.c)
+    struct bus_subscriber *bus_subs;
+    // Set while blocked in hive_bus_publish_wait() (node on own stack)
+    struct bus_pub_waiter *bus_pub_wait;
     hive_exit_reason exit_reason; // Why this actor exited
 } actor;
 
@@ -0,0 +1,33 @@
+#ifndef HIVE_ARENA_H
+#define HIVE_ARENA_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+// First-fit arena allocator over a static buffer
+// Used for variable-size blocks: actor stacks, bus storage.
+// Blocks are 16-byte aligned; the free list is kept in address order and
+// neighbours coalesce on free, so alloc and free are O(free blocks).
+
+typedef struct hive_arena_block {
+    size_t size;                   // Size of this free block (excluding header)
+    struct hive_arena_block *next; // Next free block in list
+} hive_arena_block;
+
+typedef struct {
+    uint8_t *base;
+    size_t total_size;
+    hive_arena_block *free_list;
+} hive_arena;
+
+// Initialize an arena as one free block spanning 'memory' (16-byte aligned)
+void hive_arena_init(hive_arena *arena, void *memory, size_t size);
+
+// Allocate 'size' bytes (rounded up to 16)
+// Returns NULL if no free block is large enough
+void *hive_arena_alloc(hive_arena *arena, size_t size);
+
+// Return a block to the arena (NULL is ignored)
+void hive_arena_free(hive_arena *arena, void *ptr);
+
+#endif // HIVE_ARENA_H
@@ -4,27 +4,104 @@
 #include "hive_types.h"
 #include <stdint.h>
 #include <stddef.h>
+#include <stdbool.h>
 
 // bus_id typedef is now in hive_types.h
 
 #define BUS_ID_INVALID ((bus_id)0)
 
+// Bus storage mode
+typedef enum {
+    HIVE_BUS_RING,   // Ring of max_entries entries, each with its own
+                     // payload slot in the bus's arena slab (a message
+                     // pool buffer only while that slot is borrowed)
+    HIVE_BUS_LATEST, // Single latest-value slot, overwritten in place
+} hive_bus_mode;
+
+// What publish does when the ring is full
+typedef enum {
+    HIVE_BUS_OVERFLOW_EVICT, // Drop the oldest entry, read or not (lossy)
+    HIVE_BUS_OVERFLOW_BLOCK, // Lossless: the publisher waits (or gets
+                             // HIVE_ERR_WOULDBLOCK) until every subscriber
+                             // has read the oldest entry
+} hive_bus_overflow;
+
 // Bus configuration
 typedef struct {
-    uint8_t max_subscribers;     // max concurrent subscribers
-                                 // (1..HIVE_MAX_BUS_SUBSCRIBERS)
-    uint8_t consume_after_reads; // remove entry after N reads, 0 = keep until
-                                 // aged out
+    uint16_t max_subscribers;     // max concurrent subscribers
+                                  // (1..HIVE_MAX_BUS_SUBSCRIBERS)
+    uint16_t consume_after_reads; // remove entry after N reads, 0 = keep
+                                  // until aged out
     uint32_t max_age_ms;         // expire entries after ms, 0 = no expiry
     size_t max_entries;          // ring buffer capacity
     size_t max_entry_size;       // max payload bytes per entry
+    hive_bus_mode mode;          // HIVE_BUS_LATEST ignores max_entries and
+                                 // needs consume_after_reads = 0
+    hive_bus_overflow overflow;  // HIVE_BUS_OVERFLOW_BLOCK needs a ring with
+                                 // consume_after_reads = max_age_ms = 0
 } hive_bus_config;
 
 // Default bus configuration
 #define HIVE_BUS_CONFIG_DEFAULT                                           \
     {                                                                     \
         .max_subscribers = 32, .consume_after_reads = 0, .max_age_ms = 0, \
-        .max_entries = 16, .max_entry_size = 256                          \
+        .max_entries = 16, .max_entry_size = 256, .mode = HIVE_BUS_RING,  \
+        .overflow = HIVE_BUS_OVERFLOW_EVICT                               \
+    }
+
+// Content filter callback: return true to deliver the entry. Called from
+// the publisher or the reader, normally once per entry and subscriber, so
+// it must not block, call bus functions or rely on its call count.
+typedef bool (*hive_bus_filter_fn)(const void *data, size_t len, void *ctx);
+
+// Field comparison for declarative content filters
+typedef enum {
+    HIVE_BUS_CMP_NONE, // No field filter
+    HIVE_BUS_CMP_EQ,
+    HIVE_BUS_CMP_NE,
+    HIVE_BUS_CMP_LT,
+    HIVE_BUS_CMP_LE,
+    HIVE_BUS_CMP_GT,
+    HIVE_BUS_CMP_GE,
+} hive_bus_cmp;
+
+typedef enum {
+    HIVE_BUS_FIELD_I32,
+    HIVE_BUS_FIELD_U32,
+    HIVE_BUS_FIELD_F32,
+} hive_bus_field_type;
+
+// Deliver an entry only if 'entry field <op> value'; entries too short to
+// hold the field are not delivered
+typedef struct {
+    hive_bus_cmp op;          // HIVE_BUS_CMP_NONE = no field filter
+    hive_bus_field_type type; // field type
+    uint16_t offset;          // byte offset of the field in the entry
+    union {
+        int32_t i32;
+        uint32_t u32;
+        float f32;
+    } value; // member matching 'type'
+} hive_bus_field_filter;
+
+// Subscription options (hive_bus_subscribe_ex). Filters are applied when
+// an entry is published, so a subscriber is not woken for entries they
+// reject, and reads step over those entries without counting them missed.
+typedef struct {
+    uint32_t decimation;      // deliver every Nth entry published after
+                              // subscribing, 0 or 1 = every entry
+    uint32_t min_interval_us; // deliver at most one entry per interval, the
+                              // newest one available; 0 = no limit
+    hive_bus_filter_fn filter;   // content callback, NULL = none
+    void *filter_ctx;            // passed to filter
+    hive_bus_field_filter field; // declarative content filter
+} hive_bus_sub_opts;
+
+// Default subscription options (every entry)
+#define HIVE_BUS_SUB_OPTS_DEFAULT                                         \
+    {                                                                     \
+        .decimation = 1, .min_interval_us = 0, .filter = NULL,            \
+        .filter_ctx = NULL, .field = {.op = HIVE_BUS_CMP_NONE}            \
     }
 
 // Bus operations
@@ -36,21 +113,81 @@ hive_status hive_bus_create(const hive_bus_config *cfg, bus_id *out);
 hive_status hive_bus_destroy(bus_id bus);
 
 // Publish data
+// On a HIVE_BUS_OVERFLOW_BLOCK bus, returns HIVE_ERR_WOULDBLOCK if full
 hive_status hive_bus_publish(bus_id bus, const void *data, size_t len);
 
+// Publish, waiting while a HIVE_BUS_OVERFLOW_BLOCK bus is full (as
+// hive_bus_publish() on other buses). Returns HIVE_ERR_TIMEOUT if no space
+// freed in time, HIVE_ERR_WOULDBLOCK if full and timeout_ms is 0.
+hive_status hive_bus_publish_wait(bus_id bus, const void *data, size_t len,
+                                  int32_t timeout_ms);
+
+// Publish, waiting until an absolute deadline (hive_get_time()
+// microseconds); see hive_select_until()
+hive_status hive_bus_publish_wait_until(bus_id bus, const void *data,
+                                        size_t len, uint64_t deadline_us);
+
+// Publish count entries, entry i being lens[i] bytes at data + i *
+// entry_stride, with one expiry pass and one subscriber wakeup pass. The
+// whole batch is rejected if any length is invalid. Stops early on a full
+// HIVE_BUS_OVERFLOW_BLOCK bus (HIVE_ERR_WOULDBLOCK); *published (may be
+// NULL) is the number of entries published.
+hive_status hive_bus_publish_batch(bus_id bus, const void *data,
+                                   size_t entry_stride, const size_t *lens,
+                                   size_t count, size_t *published);
+
 // Subscribe/unsubscribe current actor
 hive_status hive_bus_subscribe(bus_id bus);
 hive_status hive_bus_unsubscribe(bus_id bus);
 
+// Subscribe current actor with delivery filters (NULL = every entry)
+hive_status hive_bus_subscribe_ex(bus_id bus, const hive_bus_sub_opts *opts);
+
 // Read entry (non-blocking)
 // Returns HIVE_ERR_WOULDBLOCK if no data available
 hive_status hive_bus_read(bus_id bus, void *buf, size_t max_len,
                           size_t *bytes_read);
 
+// Read up to max_entries pending entries in one call (non-blocking). Entry i
+// is copied to buf + i * entry_stride (truncated to entry_stride) and its
+// copied length stored in lens[i]; *n is the number read. Returns
+// HIVE_ERR_WOULDBLOCK if none, HIVE_ERR_TRUNCATED if any was truncated.
+hive_status hive_bus_read_batch(bus_id bus, void *buf, size_t entry_stride,
+                                size_t max_entries, size_t *lens, size_t *n);
+
+// Borrow the next entry without copying it (non-blocking). *data points
+// into the bus and stays valid until this subscriber's next read of the
+// bus, hive_bus_release() or unsubscribe, even if the entry is evicted,
+// expired or consumed meanwhile. The entry counts as read. Do not write
+// through the pointer: other subscribers read the same payload.
+// Returns HIVE_ERR_WOULDBLOCK if no data available
+hive_status hive_bus_read_ref(bus_id bus, const void **data, size_t *len);
+
+// Return the entry borrowed by hive_bus_read_ref() (or hive_select()) early
+hive_status hive_bus_release(bus_id bus);
+
 // Read with blocking
 hive_status hive_bus_read_wait(bus_id bus, void *buf, size_t max_len,
                                size_t *bytes_read, int32_t timeout_ms);
 
+// Read with blocking until an absolute deadline (hive_get_time()
+// microseconds); see hive_select_until()
+hive_status hive_bus_read_wait_until(bus_id bus, void *buf, size_t max_len,
+                                     size_t *bytes_read, uint64_t deadline_us);
+
+// Read the newest value of a HIVE_BUS_LATEST bus whether or not it was read
+// before. *fresh (may be NULL) tells whether it was published since this
+// subscriber's last read; versions it never saw count as missed.
+// Returns HIVE_ERR_WOULDBLOCK if nothing has been published (or it expired).
+hive_status hive_bus_read_latest(bus_id bus, void *buf, size_t max_len,
+                                 size_t *bytes_read, bool *fresh);
+
+// Entries the current subscriber skipped since the previous call (or since
+// subscribing): evicted or expired before it read them, or consumed by other
+// readers first. Every entry published while subscribed is either read,
+// rejected by the subscription's filters, or counted here exactly once.
+hive_status hive_bus_missed(bus_id bus, uint64_t *missed);
+
 // Query bus state
 size_t hive_bus_entry_count(bus_id bus);
 
@@ -0,0 +1,39 @@
+#ifndef HIVE_GROUP_H
+#define HIVE_GROUP_H
+
+#include "hive_types.h"
+#include <stdint.h>
+#include <stddef.h>
+
+// Process groups - named sets of actors addressed as one multicast target
+// Membership is removed automatically when an actor dies.
+
+typedef uint32_t group_id;
+
+#define GROUP_ID_INVALID ((group_id)0)
+
+// Create an empty group
+// Returns HIVE_ERR_NOMEM if HIVE_MAX_GROUPS groups already exist.
+hive_status hive_group_create(group_id *out);
+
+// Destroy group (remaining members are removed)
+hive_status hive_group_destroy(group_id group);
+
+// Join/leave current actor
+// Join returns HIVE_ERR_EXISTS if already a member, HIVE_ERR_NOMEM if the
+// member pool (HIVE_GROUP_MEMBER_POOL_SIZE) is exhausted.
+hive_status hive_group_join(group_id group);
+hive_status hive_group_leave(group_id group);
+
+// Number of members (0 for unknown group)
+size_t hive_group_count(group_id group);
+
+// Send HIVE_MSG_NOTIFY to every member of a group
+// One shared refcounted payload for all members; one mailbox entry each.
+// All-or-nothing: returns HIVE_ERR_NOMEM without delivering anything if the
+// pools cannot hold every entry. The sender receives a copy too if it is a
+// member.
+hive_status hive_ipc_multicast(group_id group, uint32_t tag, const void *data,
+                               size_t len);
+
+#endif // HIVE_GROUP_H
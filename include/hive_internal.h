@@ -8,6 +8,7 @@
 #include "hive_io_source.h"
 #include <stddef.h>
 #include <stdbool.h>
+#include <string.h>
 
 // Internal shared types and macros for runtime implementation
 // This header is NOT part of the public API
@@ -20,6 +21,8 @@ hive_status hive_bus_init(void);
 void hive_bus_cleanup(void);
 hive_status hive_link_init(void);
 void hive_link_cleanup(void);
+hive_status hive_group_init(void);
+void hive_group_cleanup(void);
 
 #if HIVE_ENABLE_FILE
 hive_status hive_file_init(void);
@@ -36,6 +39,8 @@ void hive_net_cleanup(void);
 #define HIVE_TAG_VALUE_MASK 0x07FFFFFF // Lower 27 bits: tag value
 
 // Message data entry type (shared by IPC, bus, link, timer subsystems)
+// Reference counts live in a parallel array indexed by pool slot (see
+// hive_ipc.c), so entries stay HIVE_MAX_MESSAGE_SIZE bytes with data first.
 typedef struct {
     uint8_t data[HIVE_MAX_MESSAGE_SIZE];
 } message_data_entry;
@@ -133,20 +138,22 @@ typedef struct {
 
 // Internal helper functions (implemented in hive_ipc.c)
 
-// Free message data back to the shared message pool
+// Allocate message data from the shared message pool (refcount = 1)
+// Returns NULL if pool is exhausted. Used by: IPC, bus subsystems
+message_data_entry *hive_msg_pool_alloc(void);
+
+// Drop one reference to message data; returns it to the pool at zero
 // Handles NULL safely. Used by: IPC, bus, link subsystems
 void hive_msg_pool_free(void *data);
 
+// Take another reference to message data (dropped by hive_msg_pool_free)
+// Used by: bus subsystem (borrowed entries outlive eviction)
+void hive_msg_pool_ref(void *data);
+
 // Add mailbox entry to actor's mailbox and wake if blocked
 // Used by: timer, link subsystems (via hive_ipc_notify_ex)
 void hive_mailbox_add_entry(actor *recipient, mailbox_entry *entry);
 
-// Check for timeout message in mailbox and dequeue if present
-// Returns HIVE_ERR_TIMEOUT if timeout occurred, otherwise cancels timer and
-// returns HIVE_SUCCESS Used by: IPC recv, network I/O, bus
-hive_status hive_mailbox_handle_timeout(actor *current, timer_id timeout_timer,
-                                        const char *operation);
-
 // Free a mailbox entry and its associated data buffers
 // Used by: IPC, mailbox clear, actor cleanup
 void hive_ipc_free_entry(mailbox_entry *entry);
@@ -160,14 +167,93 @@ mailbox_entry *hive_ipc_dequeue_head(actor *a);
 // Sets HIVE_EXIT_CRASH and yields to scheduler - never returns
 _Noreturn void hive_exit_crash(void);
 
+// Clock source (Linux): monotonic microseconds from a calibrated invariant
+// TSC or vDSO clock_gettime, CLOCK_MONOTONIC timebase, ignores simulation
+// mode. hive_get_time() and all runtime timestamps go through it
+uint64_t hive_clock_us(void);
+bool hive_clock_is_tsc(void);
+
+// Convert a hive_clock_us() time to CLOCK_MONOTONIC (timerfd deadlines);
+// never returns 0 for a non-zero time
+uint64_t hive_clock_to_monotonic(uint64_t clock_us);
+
+// Coarse "now" in hive_get_time() timebase, read at most once per scheduler
+// iteration: the first call after the scheduler switches to an actor reads
+// the clock, later calls in the same run return the cached value. For
+// cheap staleness checks (bus max_age_ms), not for measuring intervals
+uint64_t hive_get_time_coarse(void);
+void hive_time_coarse_invalidate(void);
+
 // Event loop handlers (called by scheduler when I/O sources become ready)
 
 // Handle timer event (timerfd ready)
 void hive_timer_handle_event(io_source *source);
 
+// Spin-wait for a deadline within the spin threshold and fire it
+// Called by the scheduler when no actor is runnable; returns true if timers
+// fired (the caller should look for runnable actors again)
+bool hive_timer_spin(void);
+
+// Per-actor wait deadline (implemented by the timer backend)
+// Each actor slot owns one deadline entry, queued alongside the timers but
+// never delivered as a message: when it expires, the actor is made READY if
+// it is still WAITING. Blocking calls arm it before yielding, loop until
+// their event arrives or the deadline is no longer pending, then cancel it.
+// Re-arming moves the deadline; it never allocates.
+void hive_timer_deadline_arm(actor *a, uint64_t deadline_us);
+bool hive_timer_deadline_pending(const actor *a);
+void hive_timer_deadline_cancel(actor *a);
+
+// Deadline for a relative timeout_ms (HIVE_TIMEOUT_INFINITE maps to
+// HIVE_DEADLINE_NONE, HIVE_TIMEOUT_NONBLOCKING to HIVE_DEADLINE_NOW)
+uint64_t hive_deadline_after_ms(int32_t timeout_ms);
+
 // Advance simulation time and fire due timers (called by hive_advance_time)
 void hive_timer_advance_time(uint64_t delta_us);
 
+// Earliest pending timer deadline in hive_get_time() timebase
+// Returns false if no timer is pending (used by hive_run_until_idle_sim)
+bool hive_timer_next_deadline(uint64_t *deadline_us);
+
+// A timer tick left a mailbox (received or dequeued); a periodic timer stops
+// folding later expirations into it (called by IPC on every timer unlink)
+void hive_timer_tick_dequeued(timer_id id, const mailbox_entry *entry);
+
+// Timer ids encode the entry pool slot plus a per-slot generation, so both
+// backends look timers up (and cancel them) in O(1):
+//   id = generation << HIVE_TIMER_SLOT_BITS | slot, generation never 0
+// Ids double as the tick message tag, so they must fit in 28 bits.
+#define HIVE_TIMER_SLOT_BITS 16
+#define HIVE_TIMER_GEN_MASK ((1u << (28 - HIVE_TIMER_SLOT_BITS)) - 1)
+
+_Static_assert(HIVE_TIMER_ENTRY_POOL_SIZE < (1u << HIVE_TIMER_SLOT_BITS) - 1,
+               "HIVE_TIMER_ENTRY_POOL_SIZE too large for timer id encoding");
+
+// Next id for a slot, given the id it held last (0 if never used)
+static inline timer_id hive_timer_next_id(size_t slot, timer_id prev_id) {
+    uint32_t gen = ((prev_id >> HIVE_TIMER_SLOT_BITS) + 1) & HIVE_TIMER_GEN_MASK;
+    if (gen == 0) {
+        gen = 1; // Keeps ids non-zero (TIMER_ID_INVALID)
+    }
+    return (timer_id)(gen << HIVE_TIMER_SLOT_BITS | slot);
+}
+
+static inline size_t hive_timer_id_slot(timer_id id) {
+    return id & ((1u << HIVE_TIMER_SLOT_BITS) - 1);
+}
+
+// Fold 'periods' more missed periods into a queued periodic tick's payload
+// (saturating), used instead of queueing another tick for the same timer
+static inline void hive_timer_tick_add_missed(mailbox_entry *tick,
+                                              uint64_t periods) {
+    uint32_t missed;
+    uint8_t *payload = (uint8_t *)tick->data + HIVE_MSG_HEADER_SIZE;
+    memcpy(&missed, payload, sizeof(missed));
+    uint64_t total = missed + periods;
+    missed = total > UINT32_MAX ? UINT32_MAX : (uint32_t)total;
+    memcpy(payload, &missed, sizeof(missed));
+}
+
 #if HIVE_ENABLE_NET
 // Handle network event (socket ready)
 void hive_net_handle_event(io_source *source);
@@ -179,21 +265,69 @@ void hive_ipc_mailbox_clear(mailbox *mailbox);
 // Free active message entry (used during actor cleanup)
 void hive_ipc_free_active_msg(mailbox_entry *entry);
 
+// Free all retained message entries (used during actor cleanup)
+void hive_ipc_free_retained(mailbox_entry *head);
+
+// Multicast delivery state: one shared payload plus reserved mailbox entries
+// Used by: hive_ipc_multicast_list, hive_ipc_multicast (groups)
+typedef struct {
+    message_data_entry *payload; // Shared header + data (creator holds a ref)
+    mailbox_entry *reserved;     // Chain of preallocated entries (via next)
+    size_t len;                  // Header + payload length
+    actor_id sender;
+} hive_multicast;
+
+// Reserve payload and 'count' mailbox entries up front (all-or-nothing)
+// Returns HIVE_ERR_NOMEM without side effects if the pools are too small.
+hive_status hive_ipc_multicast_begin(hive_multicast *mc, size_t count,
+                                     actor_id sender, hive_msg_class class,
+                                     uint32_t tag, const void *data,
+                                     size_t len);
+
+// Deliver one reserved entry referencing the shared payload
+void hive_ipc_multicast_deliver(hive_multicast *mc, actor *recipient);
+
+// Drop the creator's payload reference and return unused entries
+void hive_ipc_multicast_end(hive_multicast *mc);
+
 // Internal notify with explicit sender, class and tag (used by timer, link,
 // etc.) Not part of public API - use hive_ipc_notify_ex() for user code
 hive_status hive_ipc_notify_internal(actor_id to, actor_id sender,
                                      hive_msg_class class, uint32_t tag,
                                      const void *data, size_t len);
 
+// Queue a timer tick (sender = owner) and return its mailbox entry, which
+// stays valid until hive_timer_tick_dequeued() reports it gone
+hive_status hive_ipc_notify_tick(actor_id owner, timer_id id,
+                                 const void *data, size_t len,
+                                 mailbox_entry **queued);
+
 // -----------------------------------------------------------------------------
 // hive_select internal helpers (implemented in hive_ipc.c and hive_bus.c)
 // -----------------------------------------------------------------------------
 
+// Maximum number of IPC filters per hive_select / hive_ipc_recv_matches call
+#define HIVE_MAX_RECV_FILTERS 16
+
+// Compile a receive filter into header mask/value form
+// Used by: hive_select
+void hive_filter_compile(const hive_recv_filter *filter,
+                         hive_compiled_filter *out);
+
+// Check a mailbox entry against a compiled filter (a few integer compares)
+static inline bool hive_filter_match(const hive_compiled_filter *filter,
+                                     const mailbox_entry *entry) {
+    uint32_t header = *(const uint32_t *)entry->data;
+    return (header & filter->mask) == filter->value &&
+           (filter->sender == HIVE_SENDER_ANY ||
+            filter->sender == entry->sender);
+}
+
 // Scan mailbox for message matching any of the filters (non-blocking)
 // Returns the matching entry and sets *matched_index to which filter matched
 // Does NOT consume the message - caller must call hive_ipc_consume_entry()
 // Used by: hive_select
-mailbox_entry *hive_ipc_scan_mailbox(const hive_recv_filter *filters,
+mailbox_entry *hive_ipc_scan_mailbox(const hive_compiled_filter *filters,
                                      size_t num_filters, size_t *matched_index);
 
 // Consume (unlink) a mailbox entry and decode into hive_message
@@ -206,6 +340,16 @@ void hive_ipc_consume_entry(mailbox_entry *entry, hive_message *msg);
 // Used by: hive_select
 bool hive_bus_has_data(bus_id bus);
 
+// If the current actor's subscription holds back unread entries because of
+// its rate limit, store when they become readable and return true
+// Used by: hive_select
+bool hive_bus_held_until(bus_id bus, uint64_t *at_us);
+
+// Make a blocked hive_select() wake at 'at_us' if that is earlier than the
+// wakeup already armed (a rate-limited bus source becomes readable then)
+// Used by: hive_bus
+void hive_select_wake_at(actor *a, uint64_t at_us);
+
 // Set blocked flag for current actor on specified bus
 // Used by: hive_select
 void hive_bus_set_blocked(bus_id bus, bool blocked);
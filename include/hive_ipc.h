@@ -23,6 +23,34 @@ hive_status hive_ipc_notify(actor_id to, uint32_t tag, const void *data,
 hive_status hive_ipc_notify_ex(actor_id to, hive_msg_class class, uint32_t tag,
                                const void *data, size_t len);
 
+// Send an out-of-band notification (HIVE_MSG_NOTIFY) in the urgent lane
+// Queued ahead of every ordinary message but behind earlier urgent ones, so
+// the next hive_ipc_recv() returns it even with a deep backlog. Intended for
+// control messages (stop, abort, mode change). Ordering against ordinary
+// messages from the same sender is NOT preserved.
+// Returns HIVE_ERR_NOMEM if IPC pools exhausted.
+hive_status hive_ipc_notify_urgent(actor_id to, uint32_t tag, const void *data,
+                                   size_t len);
+
+// Send one notification to several actors (HIVE_MSG_NOTIFY)
+// The payload is copied once and shared (refcounted) by all recipients, so
+// the cost is one message data entry plus one mailbox entry per recipient.
+// All-or-nothing: returns HIVE_ERR_INVALID if any recipient is invalid and
+// HIVE_ERR_NOMEM if the pools cannot hold every entry, without delivering.
+// See hive_group.h for multicast to a process group.
+hive_status hive_ipc_multicast_list(const actor_id *to, size_t count,
+                                    uint32_t tag, const void *data,
+                                    size_t len);
+
+// Forward a received message to another actor without copying
+// Moves the mailbox entry and payload buffer into the target's mailbox.
+// Original sender, class and tag are preserved, so replies to a forwarded
+// HIVE_MSG_REQUEST go straight back to the originator. 'msg' must be the
+// most recently received message or a retained one; on success its payload
+// is no longer valid for the caller. Never allocates, so never fails with
+// HIVE_ERR_NOMEM.
+hive_status hive_ipc_forward(const hive_message *msg, actor_id to);
+
 // Receive any message (FIFO order)
 // timeout_ms: HIVE_TIMEOUT_NONBLOCKING (0) returns HIVE_ERR_WOULDBLOCK if empty
 //             HIVE_TIMEOUT_INFINITE (-1) blocks forever
@@ -45,6 +73,18 @@ hive_status hive_ipc_recv_matches(const hive_recv_filter *filters,
                                   size_t num_filters, hive_message *msg,
                                   int32_t timeout_ms, size_t *matched_index);
 
+// Deadline variants: wait until an absolute deadline (hive_get_time()
+// microseconds) instead of for a relative timeout. HIVE_DEADLINE_NOW polls,
+// HIVE_DEADLINE_NONE blocks forever; see hive_select_until().
+hive_status hive_ipc_recv_until(hive_message *msg, uint64_t deadline_us);
+hive_status hive_ipc_recv_match_until(actor_id from, hive_msg_class class,
+                                      uint32_t tag, hive_message *msg,
+                                      uint64_t deadline_us);
+hive_status hive_ipc_recv_matches_until(const hive_recv_filter *filters,
+                                        size_t num_filters, hive_message *msg,
+                                        uint64_t deadline_us,
+                                        size_t *matched_index);
+
 // -----------------------------------------------------------------------------
 // Request/Reply Pattern
 // -----------------------------------------------------------------------------
@@ -62,6 +102,41 @@ hive_status hive_ipc_request(actor_id to, const void *request, size_t req_len,
 hive_status hive_ipc_reply(const hive_message *request, const void *data,
                            size_t len);
 
+// Reply handle for answering a request later (after further receives)
+// Plain value - can be stored anywhere, holds no runtime resources.
+typedef struct {
+    actor_id to;  // Requesting actor
+    uint32_t tag; // Request correlation tag
+} hive_reply_handle;
+
+// Capture a reply handle from a HIVE_MSG_REQUEST message
+// The handle stays valid after the request payload is released, so a server
+// can batch requests and reply once the batch has been processed.
+hive_status hive_ipc_defer_reply(const hive_message *request,
+                                 hive_reply_handle *out);
+
+// Send HIVE_MSG_REPLY through a handle from hive_ipc_defer_reply()
+// Returns HIVE_ERR_INVALID if the requester has died.
+hive_status hive_ipc_reply_deferred(const hive_reply_handle *handle,
+                                    const void *data, size_t len);
+
+// -----------------------------------------------------------------------------
+// Message Retention
+// -----------------------------------------------------------------------------
+
+// Keep a received message alive past the next receive
+// 'msg' must be the message returned by the most recent successful receive.
+// Its payload stays valid until hive_msg_release(); the mailbox entry keeps
+// counting against the global IPC pools while retained. Retaining an already
+// retained message is a no-op. Retained messages are freed when the actor
+// exits. Retain, release and forward find the entry from msg->handle in
+// O(1), however many messages are retained.
+hive_status hive_msg_retain(const hive_message *msg);
+
+// Release a message previously kept with hive_msg_retain()
+// The payload pointer is invalid after this call.
+hive_status hive_msg_release(const hive_message *msg);
+
 // -----------------------------------------------------------------------------
 // Message Inspection
 // -----------------------------------------------------------------------------
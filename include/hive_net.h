@@ -34,4 +34,18 @@ hive_status hive_net_recv(int fd, void *buf, size_t len, size_t *received,
 hive_status hive_net_send(int fd, const void *buf, size_t len, size_t *sent,
                           int32_t timeout_ms);
 
+// Deadline variants: block until an absolute deadline (hive_get_time()
+// microseconds) instead of for a relative timeout. HIVE_DEADLINE_NOW
+// returns HIVE_ERR_WOULDBLOCK if the operation would block,
+// HIVE_DEADLINE_NONE blocks forever. A read loop that passes the same
+// deadline to every hive_net_recv_until() call is bounded as a whole.
+hive_status hive_net_accept_until(int listen_fd, int *conn_fd_out,
+                                  uint64_t deadline_us);
+hive_status hive_net_connect_until(const char *ip, uint16_t port, int *fd_out,
+                                   uint64_t deadline_us);
+hive_status hive_net_recv_until(int fd, void *buf, size_t len,
+                                size_t *received, uint64_t deadline_us);
+hive_status hive_net_send_until(int fd, const void *buf, size_t len,
+                                size_t *sent, uint64_t deadline_us);
+
 #endif // HIVE_NET_H
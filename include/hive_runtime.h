@@ -26,6 +26,15 @@ hive_status hive_run_until_blocked(void);
 //   }
 void hive_advance_time(uint64_t delta_us);
 
+// Event-driven simulation: run actors until all are blocked, jump simulated
+// time straight to the next timer deadline, fire it, and repeat. Enables
+// simulation mode. Returns when nothing can run any more (no runnable actor
+// and no pending timer), all actors have exited, shutdown was requested, or
+// the next deadline lies past until_us (time is then advanced to until_us).
+// Use instead of fixed-step hive_advance_time() loops when no external model
+// needs to be stepped at a fixed rate.
+hive_status hive_run_until_idle_sim(uint64_t until_us);
+
 // Request graceful shutdown
 void hive_shutdown(void);
 
@@ -32,15 +32,25 @@
 //
 // Returns:
 //   HIVE_OK - data available from one source (check result.index)
-//   HIVE_ERR_TIMEOUT - timeout expired, no data available
+//   HIVE_ERR_TIMEOUT - timeout expired (or deadline passed), no data available
 //   HIVE_ERR_WOULDBLOCK - timeout_ms=0 and no data immediately available
 //   HIVE_ERR_INVALID - invalid arguments (NULL pointers, unsubscribed bus)
 //
 // Data lifetime:
 //   result.ipc - valid until next hive_select() or hive_ipc_recv*() call
 //   result.bus.data - valid until next hive_select() or hive_bus_read*() call
+//                     (borrowed in place via hive_bus_read_ref(), read-only)
 
 hive_status hive_select(const hive_select_source *sources, size_t num_sources,
                         hive_select_result *result, int32_t timeout_ms);
 
+// Same, waiting until an absolute deadline (hive_get_time() microseconds)
+// HIVE_DEADLINE_NOW polls, HIVE_DEADLINE_NONE blocks forever. The deadline
+// is kept on the blocked actor rather than in a timer, so waits never fail
+// with HIVE_ERR_NOMEM, and a loop of partial reads sharing one deadline
+// gives up exactly when it says instead of restarting the clock per call.
+hive_status hive_select_until(const hive_select_source *sources,
+                              size_t num_sources, hive_select_result *result,
+                              uint64_t deadline_us);
+
 #endif // HIVE_SELECT_H
@@ -68,7 +68,8 @@
 // Bus Configuration
 // -----------------------------------------------------------------------------
 
-// Maximum number of buses in the system
+// Maximum number of buses in the system (at most 65536: bus ids hold the
+// table slot in 16 bits)
 #ifndef HIVE_MAX_BUSES
 #define HIVE_MAX_BUSES 32
 #endif
@@ -78,11 +79,41 @@
 #define HIVE_MAX_BUS_ENTRIES 64
 #endif
 
-// Maximum subscribers per bus
+// Maximum subscribers per bus (upper bound for max_subscribers)
 #ifndef HIVE_MAX_BUS_SUBSCRIBERS
 #define HIVE_MAX_BUS_SUBSCRIBERS 32
 #endif
 
+// Size of global bus subscription pool (shared by all buses)
+// Each hive_bus_subscribe() call consumes one entry. The default budgets
+// four subscribers per bus table slot; one bus may still take up to its
+// max_subscribers while others have fewer. Set it to the total fan-out.
+#ifndef HIVE_BUS_SUBSCRIBER_POOL_SIZE
+#define HIVE_BUS_SUBSCRIBER_POOL_SIZE (HIVE_MAX_BUSES * 4)
+#endif
+
+// Size of bus delivery filter pool (shared by all buses)
+// Each hive_bus_subscribe_ex() call with decimation, a rate limit or a
+// content filter consumes one entry on top of its subscription entry.
+#ifndef HIVE_BUS_FILTER_POOL_SIZE
+#define HIVE_BUS_FILTER_POOL_SIZE HIVE_MAX_BUSES
+#endif
+
+// Bus storage arena size (shared by all buses)
+// hive_bus_create() carves each bus one contiguous block: a 16-byte header,
+// then max_entries entry descriptors (40 bytes each on 64-bit, 32 on
+// 32-bit) and max_entries payload slots of max_entry_size bytes (rounded up
+// to 8). Sizing rule: the sum over the buses alive at once of
+//   16 + max_entries * (descriptor + max_entry_size)
+// e.g. 7 buses * (16 + 4 * (32 + 128)) = ~4.6 KB. Every bus at the maximum
+// (HIVE_MAX_BUSES * HIVE_MAX_BUS_ENTRIES * HIVE_MAX_MESSAGE_SIZE) would
+// reserve over half a megabyte, so the default budgets 1 KB per bus table
+// slot instead: 32 buses of 8 64-byte entries, or a few
+// HIVE_BUS_CONFIG_DEFAULT buses (~4.7 KB each). Set it to the real total.
+#ifndef HIVE_BUS_ARENA_SIZE
+#define HIVE_BUS_ARENA_SIZE (HIVE_MAX_BUSES * 1024)
+#endif
+
 // -----------------------------------------------------------------------------
 // Link and Monitor Configuration
 // -----------------------------------------------------------------------------
@@ -99,6 +130,21 @@
 #define HIVE_MONITOR_ENTRY_POOL_SIZE 128
 #endif
 
+// -----------------------------------------------------------------------------
+// Process Group Configuration
+// -----------------------------------------------------------------------------
+
+// Maximum number of process groups (hive_group_create)
+#ifndef HIVE_MAX_GROUPS
+#define HIVE_MAX_GROUPS 16
+#endif
+
+// Size of global group member pool (shared by all groups)
+// Each hive_group_join() call consumes one entry
+#ifndef HIVE_GROUP_MEMBER_POOL_SIZE
+#define HIVE_GROUP_MEMBER_POOL_SIZE 128
+#endif
+
 // -----------------------------------------------------------------------------
 // Timer Configuration
 // -----------------------------------------------------------------------------
@@ -109,6 +155,28 @@
 #define HIVE_TIMER_ENTRY_POOL_SIZE 64
 #endif
 
+// Default spin-wait threshold in microseconds (Linux, 0 = never spin)
+// When idle, the scheduler sleeps until this long before the next deadline,
+// then busy-polls the clock. Override at runtime with hive_timer_set_spin()
+#ifndef HIVE_TIMER_SPIN_US
+#define HIVE_TIMER_SPIN_US 0
+#endif
+
+// -----------------------------------------------------------------------------
+// Clock Configuration
+// -----------------------------------------------------------------------------
+
+// Use a calibrated invariant TSC for time reads on x86-64 Linux (1 = on)
+// Falls back to vDSO clock_gettime when the CPU lacks an invariant TSC
+#ifndef HIVE_CLOCK_TSC
+#define HIVE_CLOCK_TSC 1
+#endif
+
+// Longest TSC extrapolation before re-syncing to CLOCK_MONOTONIC (us)
+#ifndef HIVE_CLOCK_TSC_RESYNC_US
+#define HIVE_CLOCK_TSC_RESYNC_US 100000
+#endif
+
 // -----------------------------------------------------------------------------
 // I/O Source Pool Configuration
 // -----------------------------------------------------------------------------
@@ -133,6 +201,12 @@
 #define HIVE_EPOLL_MAX_EVENTS 64
 #endif
 
+// Actor runs between non-blocking epoll polls while actors stay runnable
+// (bounds timer and I/O latency under load; 1 = poll before every run)
+#ifndef HIVE_EPOLL_POLL_INTERVAL
+#define HIVE_EPOLL_POLL_INTERVAL 16
+#endif
+
 // Epoll poll timeout in milliseconds (defensive wakeup interval)
 #ifndef HIVE_EPOLL_POLL_TIMEOUT_MS
 #define HIVE_EPOLL_POLL_TIMEOUT_MS 10
@@ -18,21 +18,85 @@ typedef uint32_t timer_id;
 // Use hive_msg_is_timer() to check, msg.tag for timer_id
 hive_status hive_timer_after(uint32_t delay_us, timer_id *out);
 
-// Periodic: wake current actor every interval
-// Timer message: class=HIVE_MSG_TIMER, tag=timer_id, no payload
+// One-shot with slack: fire any time in [delay_us, delay_us + slack_us] so
+// the runtime can batch it with other due timers into a single wakeup.
+// Use for loosely timed timeouts (heartbeats, retries).
+hive_status hive_timer_after_slack(uint32_t delay_us, uint32_t slack_us,
+                                   timer_id *out);
+
+// Periodic: wake current actor every interval (HIVE_ERR_INVALID if 0)
+// Timer message: class=HIVE_MSG_TIMER, tag=timer_id, payload=uint32_t count
+// of periods missed since the previous tick (see hive_timer_missed)
 // Use hive_msg_is_timer() to check, msg.tag for timer_id
 hive_status hive_timer_every(uint32_t interval_us, timer_id *out);
 
+// Periodic, anchored to an absolute time: ticks are due at
+// start_us + k * interval_us (hive_get_time() timebase) and never drift.
+// A start_us in the past fires immediately, reporting the missed periods.
+hive_status hive_timer_every_abs(uint64_t start_us, uint32_t interval_us,
+                                 timer_id *out);
+
+// Periods skipped before this tick (0 if on time or not a periodic tick).
+// Skipped periods are merged into the next tick rather than queued.
+uint32_t hive_timer_missed(const hive_message *msg);
+
+// Per-timer delivery statistics (lateness = delivery time - due time)
+typedef struct {
+    uint64_t ticks;         // Ticks delivered
+    uint64_t missed;        // Periods skipped (overruns)
+    uint64_t total_late_us; // Sum of lateness, for the mean
+    uint32_t last_late_us;  // Lateness of the most recent tick
+    uint32_t max_late_us;   // Worst lateness seen
+} hive_timer_stats;
+
+// Get statistics for an active timer
+hive_status hive_timer_get_stats(timer_id id, hive_timer_stats *out);
+
 // Cancel timer
 hive_status hive_timer_cancel(timer_id id);
 
+// High-precision wakeups: when no actor is runnable, sleep in the event loop
+// until spin_us before the next deadline, then busy-poll the clock for the
+// rest (burns one core for up to spin_us per wakeup). 0 disables spinning
+// (default HIVE_TIMER_SPIN_US). No effect on STM32, whose timers are tick
+// driven, or in simulation mode.
+hive_status hive_timer_set_spin(uint32_t spin_us);
+
 // Sleep for specified duration (microseconds)
-// Uses selective receive - other messages remain in mailbox
+// Messages arriving meanwhile remain in the mailbox
 hive_status hive_sleep(uint32_t delay_us);
 
+// Sleep until an absolute deadline (hive_get_time() timebase). Waits on the
+// actor's own deadline slot, so it never takes an entry from the timer pool.
+// A deadline in the past still yields once.
+hive_status hive_sleep_until(uint64_t deadline_us);
+
 // Get current time in microseconds
 // Returns monotonic time suitable for measuring elapsed durations.
 // In simulation mode, returns simulated time.
 uint64_t hive_get_time(void);
 
+#ifdef HIVE_PLATFORM_STM32
+// Hardware timer integration (STM32)
+
+// Call from the tick interrupt (SysTick or TIMx) every HIVE_TIMER_TICK_US
+void hive_timer_tick_isr(void);
+
+// Ticks counted since hive_init()
+uint32_t hive_timer_get_ticks(void);
+
+// Tickless idle hook: when no actor is runnable the scheduler calls it, with
+// interrupts masked, instead of a bare WFI. max_ticks is the distance to the
+// next timer event (0 = no timer pending, sleep until any interrupt). The
+// hook stops the periodic tick, programs the hardware timer to fire after
+// max_ticks, executes WFI, restores the periodic tick and returns the whole
+// ticks that elapsed, which the runtime adds to the tick count. It must not
+// let the pending tick interrupt for those ticks count them again.
+typedef uint32_t (*hive_timer_idle_fn)(uint32_t max_ticks);
+
+// Install (or with NULL remove) the tickless idle hook; may be called
+// before hive_init()
+void hive_timer_set_idle(hive_timer_idle_fn idle);
+#endif
+
 #endif // HIVE_TIMER_H
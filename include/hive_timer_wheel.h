@@ -0,0 +1,60 @@
+#ifndef HIVE_TIMER_WHEEL_H
+#define HIVE_TIMER_WHEEL_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// Hierarchical timer wheel over a wrapping 32-bit tick counter
+// Used by the STM32 timer backend; portable so it is unit-tested on the host.
+//
+// Level k has 32 slots of 32^k ticks each. A node is filed at the lowest
+// level whose span covers its distance from 'now' and is cascaded one level
+// down when 'now' reaches the start of its slot, so insert, remove and
+// expiry are O(1) per node. Occupancy bitmaps find the next slot that needs
+// attention without visiting empty ticks.
+
+#define HIVE_TIMER_WHEEL_BITS 5
+#define HIVE_TIMER_WHEEL_SLOTS (1u << HIVE_TIMER_WHEEL_BITS)
+#define HIVE_TIMER_WHEEL_LEVELS 7 // 7 * 5 bits cover any int32 distance
+
+// Node embedded in the caller's timer entry
+typedef struct hive_timer_wheel_node {
+    uint32_t expiry; // Absolute tick
+    uint16_t bucket; // Slot list holding the node (internal)
+    struct hive_timer_wheel_node *next;
+    struct hive_timer_wheel_node *prev;
+} hive_timer_wheel_node;
+
+typedef struct {
+    uint32_t now;                                // Last tick processed
+    uint32_t occupied[HIVE_TIMER_WHEEL_LEVELS];  // Non-empty slots per level
+    hive_timer_wheel_node *slots[HIVE_TIMER_WHEEL_LEVELS *
+                                     HIVE_TIMER_WHEEL_SLOTS +
+                                 1]; // Last list: expired, awaiting pop
+} hive_timer_wheel;
+
+// Initialize an empty wheel whose last processed tick is 'now'
+void hive_timer_wheel_init(hive_timer_wheel *w, uint32_t now);
+
+// File a node due at 'expiry'. An expiry at or before the wheel's 'now'
+// goes straight to the expired list; returns true in that case.
+bool hive_timer_wheel_insert(hive_timer_wheel *w, hive_timer_wheel_node *node,
+                             uint32_t expiry);
+
+// Unlink a node (filed or expired but not yet popped)
+void hive_timer_wheel_remove(hive_timer_wheel *w, hive_timer_wheel_node *node);
+
+// Process ticks up to and including 'now', moving every node due by then to
+// the expired list. Cost is per occupied slot, not per elapsed tick.
+void hive_timer_wheel_advance(hive_timer_wheel *w, uint32_t now);
+
+// Unlink and return the next expired node (NULL when none is left)
+hive_timer_wheel_node *hive_timer_wheel_pop(hive_timer_wheel *w);
+
+// Next tick at which the wheel has work: an expiry, or the start of a
+// higher-level slot that must be cascaded, so never later than the earliest
+// expiry. Returns the wheel's 'now' if expired nodes are waiting, false if
+// the wheel is empty.
+bool hive_timer_wheel_next(const hive_timer_wheel *w, uint32_t *tick);
+
+#endif // HIVE_TIMER_WHEEL_H
@@ -30,10 +30,27 @@ typedef enum {
 #define HIVE_TAG_NONE 0         // No tag
 #define HIVE_TAG_ANY 0x0FFFFFFF // Wildcard for filtering
 
+// Tag prefix filter (hive_recv_filter.tag only): matches every tag equal to
+// 'tag' above its low 'wildcard_bits' bits (1..27). The lowest set bit of the
+// encoded value marks where the wildcard starts, so the filter stays 32 bits.
+// Example: HIVE_TAG_PREFIX(0x0555000, 12) matches 0x0555000..0x0555FFF.
+#define HIVE_TAG_PREFIX_FLAG 0x80000000u
+#define HIVE_TAG_PREFIX(tag, wildcard_bits)                                \
+    (HIVE_TAG_PREFIX_FLAG |                                                \
+     ((uint32_t)(tag) & HIVE_TAG_ANY & ~((1u << (wildcard_bits)) - 1)) | \
+     (1u << ((wildcard_bits) - 1)))
+
 // Timeout constants for blocking operations
 #define HIVE_TIMEOUT_INFINITE ((int32_t) - 1) // Block forever
 #define HIVE_TIMEOUT_NONBLOCKING ((int32_t)0) // Return immediately
 
+// Deadline constants for the *_until() variants, which take an absolute
+// deadline in hive_get_time() microseconds instead of a relative timeout.
+// Any other deadline at or before now returns HIVE_ERR_TIMEOUT if nothing
+// is ready.
+#define HIVE_DEADLINE_NONE UINT64_MAX    // Block forever
+#define HIVE_DEADLINE_NOW ((uint64_t)0) // Return immediately (WOULDBLOCK)
+
 // Priority levels (lower value = higher priority)
 typedef enum {
     HIVE_PRIORITY_CRITICAL = 0,
@@ -111,10 +128,12 @@ typedef struct {
     uint32_t tag;         // Message tag
     size_t len;           // Payload length (excludes 4-byte header)
     const void *data; // Payload pointer (past header), valid until next recv
+    uint32_t handle;  // Runtime use: backing mailbox entry (0 = none)
 } hive_message;
 
 // Filter for selective receive (used by hive_ipc_recv_matches)
-// Use HIVE_SENDER_ANY, HIVE_MSG_ANY, HIVE_TAG_ANY for wildcards
+// Use HIVE_SENDER_ANY, HIVE_MSG_ANY, HIVE_TAG_ANY for wildcards and
+// HIVE_TAG_PREFIX() to match a family of tags
 typedef struct {
     actor_id sender;      // HIVE_SENDER_ANY for any sender
     hive_msg_class class; // HIVE_MSG_ANY for any class
@@ -158,8 +177,8 @@ typedef struct {
     union {
         hive_message ipc; // For HIVE_SEL_IPC: the received message
         struct {
-            void *data; // For HIVE_SEL_BUS: pointer to bus data
-            size_t len; // Length of bus data
+            const void *data; // For HIVE_SEL_BUS: borrowed bus entry
+            size_t len;       // Length of bus data
         } bus;
     };
 } hive_select_result;
@@ -8,6 +8,10 @@
  * 1. Initializes SysTick for timer support
  * 2. Calls the test's entry point
  * 3. Reports exit status via semihosting
+ *
+ * Built with QEMU_TICKLESS=1 (make TICKLESS=1), it also installs a tickless
+ * idle hook that stretches SysTick over each idle period, so the whole
+ * suite runs without a periodic tick while the scheduler is idle.
  */
 
 #include "semihosting.h"
@@ -22,6 +26,7 @@
 #define SYST_CSR_ENABLE (1 << 0)
 #define SYST_CSR_TICKINT (1 << 1)
 #define SYST_CSR_CLKSOURCE (1 << 2)
+#define SYST_CSR_COUNTFLAG (1 << 16)
 
 /* LM3S6965 runs at 12 MHz in QEMU */
 #define CPU_CLOCK_HZ 12000000
@@ -37,11 +42,68 @@ static void systick_init(void) {
                SYST_CSR_CLKSOURCE; /* Use processor clock */
 }
 
+#if QEMU_TICKLESS
+#include "hive_timer.h"
+
+/* Interrupt Control and State Register: SysTick pending bits */
+#define SCB_ICSR (*(volatile uint32_t *)0xE000ED04)
+#define SCB_ICSR_PENDSTSET (1u << 26)
+#define SCB_ICSR_PENDSTCLR (1u << 25)
+
+#define CYCLES_PER_TICK (CPU_CLOCK_HZ / TICK_RATE_HZ)
+#define SYST_MAX_TICKS (0x00FFFFFFu / CYCLES_PER_TICK) /* 24-bit reload */
+
+/*
+ * Tickless idle hook (runs with interrupts masked): replace the periodic
+ * reload with one period that ends max_ticks from the current tick, sleep,
+ * then count the ticks that passed and return to the 1ms period
+ */
+static uint32_t systick_idle(uint32_t max_ticks) {
+    if (max_ticks == 0 || max_ticks > SYST_MAX_TICKS) {
+        max_ticks = SYST_MAX_TICKS;
+    }
+    if (max_ticks < 2 || (SCB_ICSR & SCB_ICSR_PENDSTSET)) {
+        __asm__ volatile("wfi"); /* Next tick is due anyway */
+        return 0;
+    }
+
+    SYST_CSR = SYST_CSR_TICKINT | SYST_CSR_CLKSOURCE; /* Stop */
+    if (SCB_ICSR & SCB_ICSR_PENDSTSET) {
+        SYST_CSR |= SYST_CSR_ENABLE; /* Wrapped while stopping */
+        return 0;
+    }
+    uint32_t left = SYST_CVR; /* Cycles to the end of the current tick */
+    uint32_t reload = left + (max_ticks - 1) * CYCLES_PER_TICK - 1;
+    SYST_RVR = reload;
+    SYST_CVR = 0;
+    SYST_CSR = SYST_CSR_ENABLE | SYST_CSR_TICKINT | SYST_CSR_CLKSOURCE;
+
+    __asm__ volatile("wfi");
+
+    uint32_t csr = SYST_CSR;
+    SYST_CSR = SYST_CSR_TICKINT | SYST_CSR_CLKSOURCE;
+    uint32_t ticks;
+    if (csr & SYST_CSR_COUNTFLAG) {
+        ticks = max_ticks;
+        SCB_ICSR = SCB_ICSR_PENDSTCLR; /* Returned here, not via the ISR */
+    } else {
+        /* Woken early by another interrupt: whole ticks only */
+        uint32_t done = reload - SYST_CVR;
+        ticks = done < left ? 0 : 1 + (done - left) / CYCLES_PER_TICK;
+    }
+    systick_init();
+    return ticks;
+}
+#endif
+
 /* Test's main() is renamed to test_main via -Dmain=test_main */
 extern int test_main(void);
 
 int main(void) {
     systick_init();
+#if QEMU_TICKLESS
+    hive_timer_set_idle(systick_idle);
+#endif
 
     int result = test_main();
 
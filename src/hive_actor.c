@@ -2,30 +2,15 @@
 #include "hive_static_config.h"
 #include "hive_internal.h"
 #include "hive_log.h"
+#include "hive_arena.h"
 #include <stdlib.h>
 #include <string.h>
 #include <stdint.h>
 
-// Stack arena allocator for actor stacks
-typedef struct arena_block {
-    size_t size;              // Size of this free block (excluding header)
-    struct arena_block *next; // Next free block in list
-} arena_block;
-
-typedef struct {
-    uint8_t *base;
-    size_t total_size;
-    arena_block *free_list;
-} stack_arena;
-
-// Stack alignment for x86-64 ABI
-#define STACK_ALIGNMENT 16
-#define MIN_BLOCK_SIZE 64
-
-// Static arena storage (16-byte aligned)
+// Static arena storage for actor stacks (16-byte aligned)
 static uint8_t s_stack_arena_memory[HIVE_STACK_ARENA_SIZE]
     __attribute__((aligned(16)));
-static stack_arena s_stack_arena = {0};
+static hive_arena s_stack_arena;
 
 // Static actor storage
 static actor s_actors[HIVE_MAX_ACTORS];
@@ -36,112 +21,10 @@ static actor_table s_actor_table = {0};
 // Current running actor
 static actor *s_current_actor = NULL;
 
-// Initialize stack arena
-static void arena_init(void) {
-    s_stack_arena.base = s_stack_arena_memory;
-    s_stack_arena.total_size = HIVE_STACK_ARENA_SIZE;
-
-    // Initialize with one large free block
-    arena_block *block = (arena_block *)s_stack_arena.base;
-    block->size = HIVE_STACK_ARENA_SIZE - sizeof(arena_block);
-    block->next = NULL;
-    s_stack_arena.free_list = block;
-}
-
-// Allocate from arena with 16-byte alignment
-static void *arena_alloc(size_t size) {
-    // Round size to alignment
-    size = (size + STACK_ALIGNMENT - 1) & ~(STACK_ALIGNMENT - 1);
-
-    // Search free list for first-fit
-    arena_block **prev_ptr = &s_stack_arena.free_list;
-    arena_block *curr = s_stack_arena.free_list;
-
-    while (curr != NULL) {
-        if (curr->size >= size) {
-            // Found suitable block
-            size_t remaining = curr->size - size;
-
-            // Check if we should split the block
-            if (remaining >= sizeof(arena_block) + MIN_BLOCK_SIZE) {
-                // Split: allocate from beginning, create new free block
-                arena_block *new_block =
-                    (arena_block *)((uint8_t *)curr + sizeof(arena_block) +
-                                    size);
-                new_block->size = remaining - sizeof(arena_block);
-                new_block->next = curr->next;
-                *prev_ptr = new_block;
-
-                curr->size = size;
-            } else {
-                // Don't split, use entire block
-                *prev_ptr = curr->next;
-            }
-
-            // Return usable space (after header)
-            return (uint8_t *)curr + sizeof(arena_block);
-        }
-
-        prev_ptr = &curr->next;
-        curr = curr->next;
-    }
-
-    return NULL; // No suitable block found
-}
-
-// Free to arena with coalescing
-static void arena_free(void *ptr) {
-    if (!ptr) {
-        return;
-    }
-
-    // Get block header
-    arena_block *block = (arena_block *)((uint8_t *)ptr - sizeof(arena_block));
-
-    // Insert into free list (maintain address-sorted order) and coalesce
-    arena_block **prev_ptr = &s_stack_arena.free_list;
-    arena_block *curr = s_stack_arena.free_list;
-    arena_block *prev_block = NULL;
-
-    // Find insertion point
-    while (curr != NULL && curr < block) {
-        prev_block = curr;
-        prev_ptr = &curr->next;
-        curr = curr->next;
-    }
-
-    // Insert block
-    block->next = curr;
-    *prev_ptr = block;
-
-    // Coalesce with previous block if adjacent
-    if (prev_block != NULL) {
-        uint8_t *prev_end =
-            (uint8_t *)prev_block + sizeof(arena_block) + prev_block->size;
-        if (prev_end == (uint8_t *)block) {
-            // Merge with previous
-            prev_block->size += sizeof(arena_block) + block->size;
-            prev_block->next = block->next;
-            block = prev_block;
-        }
-    }
-
-    // Coalesce with next block if adjacent
-    if (block->next != NULL) {
-        uint8_t *block_end =
-            (uint8_t *)block + sizeof(arena_block) + block->size;
-        if (block_end == (uint8_t *)block->next) {
-            // Merge with next
-            arena_block *next = block->next;
-            block->size += sizeof(arena_block) + next->size;
-            block->next = next->next;
-        }
-    }
-}
-
 hive_status hive_actor_init(void) {
     // Initialize stack arena
-    arena_init();
+    hive_arena_init(&s_stack_arena, s_stack_arena_memory,
+                    HIVE_STACK_ARENA_SIZE);
 
     // Use static actor array (already zero-initialized by C)
     s_actor_table.actors = s_actors;
@@ -161,7 +44,7 @@ void hive_actor_cleanup(void) {
                 if (a->stack_is_malloced) {
                     free(a->stack);
                 } else {
-                    arena_free(a->stack);
+                    hive_arena_free(&s_stack_arena, a->stack);
                 }
                 hive_ipc_mailbox_clear(&a->mailbox);
             }
@@ -222,7 +105,7 @@ actor *hive_actor_alloc(actor_fn fn, void *args,
         is_malloced = true;
     } else {
         // Use arena allocator (no fallback)
-        stack = arena_alloc(stack_size);
+        stack = hive_arena_alloc(&s_stack_arena, stack_size);
         is_malloced = false;
     }
 
@@ -246,9 +129,9 @@ actor *hive_actor_alloc(actor_fn fn, void *args,
     a->startup_siblings = siblings;
     a->startup_sibling_count = sibling_count;
 
-    // Initialize receive filters (NULL = no active filter)
-    a->recv_filters = NULL;
-    a->recv_filter_count = 0;
+    // Initialize wake filters (only set while blocked in hive_select)
+    a->wake_filters = NULL;
+    a->wake_filter_count = 0;
 
     // Initialize context with actor function
     // Startup info (args, siblings, count) is stored in actor struct
@@ -262,9 +145,10 @@ actor *hive_actor_alloc(actor_fn fn, void *args,
 }
 
 // External cleanup functions
-extern void hive_bus_cleanup_actor(actor_id id);
+extern void hive_bus_cleanup_actor(actor *a);
 extern void hive_link_cleanup_actor(actor_id id);
 extern void hive_registry_cleanup_actor(actor_id id);
+extern void hive_group_cleanup_actor(actor_id id);
 
 void hive_actor_free(actor *a) {
     if (!a) {
@@ -275,17 +159,20 @@ void hive_actor_free(actor *a) {
     hive_link_cleanup_actor(a->id);
 
     // Cleanup bus subscriptions
-    hive_bus_cleanup_actor(a->id);
+    hive_bus_cleanup_actor(a);
 
     // Cleanup registry entries
     hive_registry_cleanup_actor(a->id);
 
+    // Cleanup process group memberships
+    hive_group_cleanup_actor(a->id);
+
     // Free stack
     if (a->stack) {
         if (a->stack_is_malloced) {
             free(a->stack);
         } else {
-            arena_free(a->stack);
+            hive_arena_free(&s_stack_arena, a->stack);
         }
         a->stack = NULL;
     }
@@ -296,6 +183,10 @@ void hive_actor_free(actor *a) {
         a->active_msg = NULL;
     }
 
+    // Free messages kept with hive_msg_retain()
+    hive_ipc_free_retained(a->retained);
+    a->retained = NULL;
+
     // Free mailbox entries
     hive_ipc_mailbox_clear(&a->mailbox);
 
@@ -0,0 +1,108 @@
+#include "hive_arena.h"
+
+// Block alignment (x86-64 ABI stack alignment)
+#define ARENA_ALIGNMENT 16
+#define MIN_BLOCK_SIZE 64
+
+void hive_arena_init(hive_arena *arena, void *memory, size_t size) {
+    arena->base = memory;
+    arena->total_size = size;
+
+    // Initialize with one large free block
+    hive_arena_block *block = (hive_arena_block *)arena->base;
+    block->size = size - sizeof(hive_arena_block);
+    block->next = NULL;
+    arena->free_list = block;
+}
+
+// Allocate from arena with 16-byte alignment
+void *hive_arena_alloc(hive_arena *arena, size_t size) {
+    // Round size to alignment
+    size = (size + ARENA_ALIGNMENT - 1) & ~(size_t)(ARENA_ALIGNMENT - 1);
+
+    // Search free list for first-fit
+    hive_arena_block **prev_ptr = &arena->free_list;
+    hive_arena_block *curr = arena->free_list;
+
+    while (curr != NULL) {
+        if (curr->size >= size) {
+            // Found suitable block
+            size_t remaining = curr->size - size;
+
+            // Check if we should split the block
+            if (remaining >= sizeof(hive_arena_block) + MIN_BLOCK_SIZE) {
+                // Split: allocate from beginning, create new free block
+                hive_arena_block *new_block =
+                    (hive_arena_block *)((uint8_t *)curr +
+                                         sizeof(hive_arena_block) + size);
+                new_block->size = remaining - sizeof(hive_arena_block);
+                new_block->next = curr->next;
+                *prev_ptr = new_block;
+
+                curr->size = size;
+            } else {
+                // Don't split, use entire block
+                *prev_ptr = curr->next;
+            }
+
+            // Return usable space (after header)
+            return (uint8_t *)curr + sizeof(hive_arena_block);
+        }
+
+        prev_ptr = &curr->next;
+        curr = curr->next;
+    }
+
+    return NULL; // No suitable block found
+}
+
+// Free to arena with coalescing
+void hive_arena_free(hive_arena *arena, void *ptr) {
+    if (!ptr) {
+        return;
+    }
+
+    // Get block header
+    hive_arena_block *block =
+        (hive_arena_block *)((uint8_t *)ptr - sizeof(hive_arena_block));
+
+    // Insert into free list (maintain address-sorted order) and coalesce
+    hive_arena_block **prev_ptr = &arena->free_list;
+    hive_arena_block *curr = arena->free_list;
+    hive_arena_block *prev_block = NULL;
+
+    // Find insertion point
+    while (curr != NULL && curr < block) {
+        prev_block = curr;
+        prev_ptr = &curr->next;
+        curr = curr->next;
+    }
+
+    // Insert block
+    block->next = curr;
+    *prev_ptr = block;
+
+    // Coalesce with previous block if adjacent
+    if (prev_block != NULL) {
+        uint8_t *prev_end = (uint8_t *)prev_block + sizeof(hive_arena_block) +
+                            prev_block->size;
+        if (prev_end == (uint8_t *)block) {
+            // Merge with previous
+            prev_block->size += sizeof(hive_arena_block) + block->size;
+            prev_block->next = block->next;
+            block = prev_block;
+        }
+    }
+
+    // Coalesce with next block if adjacent
+    if (block->next != NULL) {
+        uint8_t *block_end =
+            (uint8_t *)block + sizeof(hive_arena_block) + block->size;
+        if (block_end == (uint8_t *)block->next) {
+            // Merge with next
+            hive_arena_block *next = block->next;
+            block->size += sizeof(hive_arena_block) + next->size;
+            block->next = next->next;
+        }
+    }
+}
@@ -2,118 +2,435 @@
 #include "hive_internal.h"
 #include "hive_static_config.h"
 #include "hive_pool.h"
+#include "hive_arena.h"
 #include "hive_actor.h"
 #include "hive_scheduler.h"
 #include "hive_runtime.h"
 #include "hive_log.h"
 #include "hive_select.h"
 #include <string.h>
-#include <sys/time.h>
-
-// Compile-time check: readers_mask is uint32_t, so max 32 subscribers
-_Static_assert(
-    HIVE_MAX_BUS_SUBSCRIBERS <= 32,
-    "HIVE_MAX_BUS_SUBSCRIBERS exceeds readers_mask capacity (32 bits)");
-
-// External IPC pools (defined in hive_ipc.c)
-extern hive_pool g_message_pool_mgr;
 
 // Forward declaration for internal function
-void hive_bus_cleanup_actor(actor_id id);
+void hive_bus_cleanup_actor(actor *a);
 
 // Bus entry in ring buffer
 typedef struct {
-    void *data;            // Payload
+    void *data;            // Payload: this index's slab slot, or a message
+                           // pool buffer while that slot is still borrowed
     size_t len;            // Payload length
+    uint64_t seq;          // Sequence number (publish order, never reused)
     uint64_t timestamp_ms; // When entry was published
-    uint8_t read_count;    // How many actors have read this
+    uint16_t read_count;   // How many subscribers have read this
+    uint16_t leases;       // Borrowers of this index's slab slot
+    uint16_t pending;      // Lossless bus: subscribers yet to pass it
     bool valid;            // Is this entry valid?
-    uint32_t readers_mask; // Bitmask of which subscribers have read (max 32
-                           // subscribers)
 } bus_entry;
 
-// Subscriber info
-typedef struct {
-    actor_id id;
-    size_t next_read_idx; // Next entry index to read
-    bool active;
+struct bus_t;
+
+// Subscription (one per subscribed actor and bus, from a shared pool)
+// Linked into the subscribing actor's list, which is how an actor finds its
+// subscription without scanning the bus, and while it waits into the bus's
+// list of blocked subscribers, which is all a publish walks.
+// Delivery filters of a hive_bus_subscribe_ex() subscription. Few
+// subscriptions use them, so they come from a pool of their own and keep
+// the subscriber node small.
+typedef struct bus_sub_filter {
+    uint64_t phase; // Decimation: entries phase, phase + N, ... pass
+    uint64_t next_delivery_us;   // Rate limit: no delivery before this
+    uint32_t decimation;         // Deliver every Nth entry (1 = all)
+    uint32_t min_interval_us;    // At most one delivery per interval
+    hive_bus_filter_fn filter;   // Content callback (NULL = none)
+    void *filter_ctx;
+    hive_bus_field_filter field; // Declarative content filter
+    uint64_t passed_seq; // Entry seq + 1 the content filters last passed
+} bus_sub_filter;
+
+typedef struct bus_subscriber {
+    struct bus_t *bus;
+    actor *owner;
+    uint64_t cursor; // Sequence number of the next entry to read
+    uint64_t missed; // Entries skipped since the last hive_bus_missed()
+    void *lease;     // Payload borrowed by hive_bus_read_ref()
+    bus_sub_filter *opts; // Delivery filters (NULL = every entry)
+    struct bus_subscriber *next; // Owner's next subscription
+    struct bus_subscriber *blocked_next;
+    struct bus_subscriber *blocked_prev;
     bool blocked; // Is actor blocked waiting for data?
 } bus_subscriber;
 
+// Publisher waiting for space on a full lossless bus; lives on the
+// publisher's stack and is found from the actor for cleanup
+typedef struct bus_pub_waiter {
+    struct bus_t *bus;
+    actor *owner;
+    struct bus_pub_waiter *next;
+    struct bus_pub_waiter *prev;
+} bus_pub_waiter;
+
 // Bus structure
-typedef struct {
+typedef struct bus_t {
     bus_id id;
     hive_bus_config config;
-    bus_entry *entries;          // Ring buffer (dynamically allocated)
-    size_t head;                 // Write position
-    size_t tail;                 // Oldest entry position
-    size_t count;                // Number of valid entries
-    bus_subscriber *subscribers; // Dynamically allocated array
+    bus_entry *entries;      // Ring buffer (carved from the bus arena)
+    uint8_t *slab;           // Payload slots, one per entry, after entries
+    size_t stride;           // Bytes per payload slot
+    size_t head;             // Write position
+    size_t tail;             // Oldest entry position
+    size_t count;            // Number of valid entries
+    uint64_t next_seq;       // Sequence number of the next publish
+    bus_subscriber *blocked; // Subscribers waiting for data
+    bus_pub_waiter *pub_waiters; // Publishers waiting for space
     size_t num_subscribers;
     bool active;
 } bus_t;
 
-// Static bus storage
+// Static bus storage; entries and payloads come from the arena per bus
 static bus_t s_buses[HIVE_MAX_BUSES];
-static bus_entry s_bus_entries[HIVE_MAX_BUSES][HIVE_MAX_BUS_ENTRIES];
-static bus_subscriber s_bus_subscribers[HIVE_MAX_BUSES]
-                                       [HIVE_MAX_BUS_SUBSCRIBERS];
+static uint8_t s_bus_arena_memory[HIVE_BUS_ARENA_SIZE]
+    __attribute__((aligned(16)));
+static hive_arena s_bus_arena;
+
+// Subscription pool (shared by all buses)
+static bus_subscriber s_subscriber_pool[HIVE_BUS_SUBSCRIBER_POOL_SIZE];
+static bool s_subscriber_used[HIVE_BUS_SUBSCRIBER_POOL_SIZE];
+static hive_pool s_subscriber_pool_mgr;
+
+// Delivery filter pool (subscriptions with non-default options)
+static bus_sub_filter s_filter_pool[HIVE_BUS_FILTER_POOL_SIZE];
+static bool s_filter_used[HIVE_BUS_FILTER_POOL_SIZE];
+static hive_pool s_filter_pool_mgr;
 
 // Bus table
 static struct {
     bus_t *buses;     // Points to static s_buses array
     size_t max_buses; // Maximum number of buses
-    bus_id next_id;
     bool initialized;
 } s_bus_table = {0};
 
-// Get current time in milliseconds
+// Bus ids encode the table slot plus a per-slot generation, so lookup is
+// O(1) and an id outlived by its bus is rejected even once the slot is
+// reused:
+//   id = generation << BUS_SLOT_BITS | slot, generation never 0
+#define BUS_SLOT_BITS 16
+#define BUS_GEN_MASK ((1u << (32 - BUS_SLOT_BITS)) - 1)
+
+_Static_assert(HIVE_MAX_BUSES <= (1u << BUS_SLOT_BITS),
+               "HIVE_MAX_BUSES too large for bus id encoding");
+
+// Next id for a slot, given the id it held last (0 if never used)
+static bus_id next_bus_id(size_t slot, bus_id prev_id) {
+    uint32_t gen = ((prev_id >> BUS_SLOT_BITS) + 1) & BUS_GEN_MASK;
+    if (gen == 0) {
+        gen = 1; // Keeps ids non-zero (BUS_ID_INVALID)
+    }
+    return (bus_id)(gen << BUS_SLOT_BITS | slot);
+}
+
+// Current time in milliseconds for entry ages: the coarse per-iteration
+// "now" (one clock read per actor run at most, simulated time in
+// simulation mode)
 static uint64_t get_time_ms(void) {
-#ifdef HIVE_PLATFORM_STM32
-    // On STM32, use hive_timer which provides millisecond ticks
-    extern uint32_t hive_timer_get_ticks(void);
-    return (uint64_t)hive_timer_get_ticks();
-#else
-    struct timeval tv;
-    gettimeofday(&tv, NULL);
-    return (uint64_t)tv.tv_sec * 1000 + tv.tv_usec / 1000;
-#endif
+    return hive_get_time_coarse() / 1000;
 }
 
 // Find bus by ID
+// O(1) lookup: the id names the slot, the generation rejects stale ids
 static bus_t *find_bus(bus_id id) {
-    if (id == BUS_ID_INVALID) {
+    size_t slot = id & ((1u << BUS_SLOT_BITS) - 1);
+    if (id == BUS_ID_INVALID || slot >= s_bus_table.max_buses) {
         return NULL;
     }
 
-    for (size_t i = 0; i < s_bus_table.max_buses; i++) {
-        if (s_bus_table.buses[i].active && s_bus_table.buses[i].id == id) {
-            return &s_bus_table.buses[i];
-        }
+    bus_t *bus = &s_bus_table.buses[slot];
+    if (!bus->active || bus->id != id) {
+        return NULL;
     }
+    return bus;
+}
 
+// Find an actor's subscription to a bus: walks the actor's own
+// subscriptions, so the cost does not grow with the bus's subscriber count
+static bus_subscriber *find_subscriber(bus_t *bus, const actor *a) {
+    for (bus_subscriber *sub = a->bus_subs; sub; sub = sub->next) {
+        if (sub->bus == bus) {
+            return sub;
+        }
+    }
     return NULL;
 }
 
-// Find subscriber index in bus
-static int find_subscriber(bus_t *bus, actor_id id) {
-    for (size_t i = 0; i < bus->config.max_subscribers; i++) {
-        if (bus->subscribers[i].active && bus->subscribers[i].id == id) {
-            return (int)i;
+static void blocked_unlink(bus_subscriber *sub) {
+    if (!sub->blocked) {
+        return;
+    }
+    if (sub->blocked_prev) {
+        sub->blocked_prev->blocked_next = sub->blocked_next;
+    } else {
+        sub->bus->blocked = sub->blocked_next;
+    }
+    if (sub->blocked_next) {
+        sub->blocked_next->blocked_prev = sub->blocked_prev;
+    }
+    sub->blocked = false;
+}
+
+// Payload slots are fixed per entry index, so the ring's payloads sit in
+// one contiguous block in publish order
+static void *slab_slot(bus_t *bus, size_t idx) {
+    return bus->slab + idx * bus->stride;
+}
+
+static bool in_slab(const bus_t *bus, const void *p) {
+    const uint8_t *b = p;
+    return b >= bus->slab &&
+           b < bus->slab + bus->config.max_entries * bus->stride;
+}
+
+// End a subscriber's borrow. A slab slot just loses a borrower; a message
+// pool buffer (the entry was published while its slot was borrowed) drops
+// the lease's reference, freeing it if the entry is gone.
+static void release_lease(bus_subscriber *sub) {
+    if (!sub->lease) {
+        return;
+    }
+    bus_t *bus = sub->bus;
+    if (in_slab(bus, sub->lease)) {
+        size_t idx = (size_t)((uint8_t *)sub->lease - bus->slab) / bus->stride;
+        bus->entries[idx].leases--;
+    } else {
+        hive_msg_pool_free(sub->lease);
+    }
+    sub->lease = NULL;
+}
+
+// Subscription filters (hive_bus_subscribe_ex). Decimation depends only on
+// the sequence number, so publish and read agree on which entries pass.
+static bool passes_decimation(const bus_sub_filter *f, uint64_t seq) {
+    return f->decimation <= 1 || (seq - f->phase) % f->decimation == 0;
+}
+
+static bool field_matches(const hive_bus_field_filter *f, const void *data,
+                          size_t len) {
+    if (f->op == HIVE_BUS_CMP_NONE) {
+        return true;
+    }
+    if ((size_t)f->offset + 4 > len) {
+        return false;
+    }
+
+    // Compare as -1/0/1 so one switch serves all field types
+    const uint8_t *field = (const uint8_t *)data + f->offset;
+    int cmp;
+    switch (f->type) {
+    case HIVE_BUS_FIELD_I32: {
+        int32_t v;
+        memcpy(&v, field, sizeof(v));
+        cmp = (v > f->value.i32) - (v < f->value.i32);
+        break;
+    }
+    case HIVE_BUS_FIELD_U32: {
+        uint32_t v;
+        memcpy(&v, field, sizeof(v));
+        cmp = (v > f->value.u32) - (v < f->value.u32);
+        break;
+    }
+    case HIVE_BUS_FIELD_F32: {
+        float v;
+        memcpy(&v, field, sizeof(v));
+        if (v != v) {
+            return f->op == HIVE_BUS_CMP_NE; // NaN matches only "not equal"
         }
+        cmp = (v > f->value.f32) - (v < f->value.f32);
+        break;
+    }
+    default:
+        return false;
+    }
+
+    switch (f->op) {
+    case HIVE_BUS_CMP_EQ:
+        return cmp == 0;
+    case HIVE_BUS_CMP_NE:
+        return cmp != 0;
+    case HIVE_BUS_CMP_LT:
+        return cmp < 0;
+    case HIVE_BUS_CMP_LE:
+        return cmp <= 0;
+    case HIVE_BUS_CMP_GT:
+        return cmp > 0;
+    case HIVE_BUS_CMP_GE:
+        return cmp >= 0;
+    default:
+        return false;
+    }
+}
+
+// Content filters normally see each entry once per subscriber: a pass is
+// remembered for the read that follows the wakeup, and a rejected entry is
+// stepped over for good (rate-limited walks may check entries again)
+static bool passes_content(bus_sub_filter *f, const bus_entry *e) {
+    if (!f->filter && f->field.op == HIVE_BUS_CMP_NONE) {
+        return true;
+    }
+    if (f->passed_seq == e->seq + 1) {
+        return true;
+    }
+    if (!field_matches(&f->field, e->data, e->len) ||
+        (f->filter && !f->filter(e->data, e->len, f->filter_ctx))) {
+        return false;
+    }
+    f->passed_seq = e->seq + 1;
+    return true;
+}
+
+static bool accepts(bus_subscriber *sub, const bus_entry *e) {
+    bus_sub_filter *f = sub->opts;
+    return !f || (passes_decimation(f, e->seq) && passes_content(f, e));
+}
+
+static bool rate_limited(const bus_subscriber *sub) {
+    return sub->opts && sub->opts->min_interval_us > 0 &&
+           hive_get_time_coarse() < sub->opts->next_delivery_us;
+}
+
+// Drop an entry's payload. Slab slots stay with the bus; a message pool
+// buffer drops the bus's reference (a borrower may still hold one).
+static void release_entry(bus_t *bus, bus_entry *entry) {
+    if (entry->valid && !in_slab(bus, entry->data)) {
+        hive_msg_pool_free(entry->data);
+    }
+    entry->valid = false;
+}
+
+// Lossless bus: free the oldest entries every subscriber has passed, and
+// let waiting publishers retry
+static void trim_passed(bus_t *bus) {
+    size_t freed = 0;
+    while (bus->count > 0) {
+        bus_entry *e = &bus->entries[bus->tail];
+        if (e->valid && e->pending > 0) {
+            break;
+        }
+        release_entry(bus, e);
+        bus->tail = (bus->tail + 1) % bus->config.max_entries;
+        bus->count--;
+        freed++;
+    }
+    if (freed == 0) {
+        return;
+    }
+    for (bus_pub_waiter *w = bus->pub_waiters; w; w = w->next) {
+        if (w->owner->state == ACTOR_STATE_WAITING) {
+            w->owner->state = ACTOR_STATE_READY;
+        }
+    }
+}
+
+// Take the publisher off the bus's list of publishers waiting for space
+static void pub_waiter_unlink(bus_pub_waiter *w) {
+    if (!w->bus) {
+        return;
+    }
+    if (w->prev) {
+        w->prev->next = w->next;
+    } else {
+        w->bus->pub_waiters = w->next;
+    }
+    if (w->next) {
+        w->next->prev = w->prev;
+    }
+    w->bus = NULL;
+    w->owner->bus_pub_wait = NULL;
+}
+
+// Move a subscriber's cursor forward. On a lossless bus every entry it
+// leaves behind has one subscriber fewer to wait for.
+static void advance_cursor(bus_t *bus, bus_subscriber *sub, uint64_t to) {
+    if (bus->config.overflow != HIVE_BUS_OVERFLOW_BLOCK) {
+        sub->cursor = to;
+        return;
+    }
+    uint64_t oldest = bus->next_seq - bus->count;
+    for (uint64_t seq = sub->cursor < oldest ? oldest : sub->cursor; seq < to;
+         seq++) {
+        bus_entry *e = &bus->entries[seq % bus->config.max_entries];
+        if (e->valid && e->pending > 0) {
+            e->pending--;
+        }
+    }
+    sub->cursor = to;
+    trim_passed(bus);
+}
+
+// Entry with sequence number 'seq' lives at index seq % max_entries (head
+// advances in step with next_seq), and the ring holds the sequence numbers
+// [next_seq - count, next_seq). Move the subscriber's cursor onto its next
+// readable entry, counting every entry it steps over as missed: evicted or
+// expired before it got there, or consumed by other readers. Entries the
+// subscription's filters reject are stepped over without counting. Returns
+// NULL when it has read everything. O(1) apart from consumed holes and
+// decimated entries, which each subscriber steps over once.
+static bus_entry *next_unread(bus_t *bus, bus_subscriber *sub) {
+    uint64_t oldest = bus->next_seq - bus->count;
+    if (sub->cursor < oldest) {
+        sub->missed += oldest - sub->cursor;
+        advance_cursor(bus, sub, oldest);
+    }
+    if (sub->cursor >= bus->next_seq || rate_limited(sub)) {
+        return NULL;
+    }
+
+    // Rate-limited: the newest passing entry wins and everything older is
+    // skipped (a backward walk of at most the ring)
+    if (sub->opts && sub->opts->min_interval_us > 0) {
+        for (uint64_t seq = bus->next_seq; seq-- > sub->cursor;) {
+            bus_entry *e = &bus->entries[seq % bus->config.max_entries];
+            if (e->valid && accepts(sub, e)) {
+                advance_cursor(bus, sub, seq);
+                return e;
+            }
+        }
+        advance_cursor(bus, sub, bus->next_seq);
+        return NULL;
+    }
+
+    while (sub->cursor < bus->next_seq) {
+        bus_entry *e = &bus->entries[sub->cursor % bus->config.max_entries];
+        if (!e->valid) {
+            sub->missed++;
+        } else if (accepts(sub, e)) {
+            return e;
+        }
+        advance_cursor(bus, sub, sub->cursor + 1);
+    }
+    return NULL;
+}
+
+// Unlink a subscription from its bus and owner and return it to the pool.
+// On a lossless bus it stops holding back the entries it has not read.
+static void remove_subscriber(bus_subscriber *sub) {
+    release_lease(sub);
+    blocked_unlink(sub);
+    advance_cursor(sub->bus, sub, sub->bus->next_seq);
+    SLIST_REMOVE(sub->owner->bus_subs, sub);
+    sub->bus->num_subscribers--;
+    if (sub->opts) {
+        hive_pool_free(&s_filter_pool_mgr, sub->opts);
     }
-    return -1;
+    hive_pool_free(&s_subscriber_pool_mgr, sub);
 }
 
-// Free all valid entry data in a bus (used during cleanup/destroy)
+// Free all entry data and return the bus's storage to the arena
+// (used during cleanup/destroy)
 static void free_bus_entries(bus_t *bus) {
     for (size_t i = 0; i < bus->config.max_entries; i++) {
-        if (bus->entries[i].valid) {
-            hive_msg_pool_free(bus->entries[i].data);
-            bus->entries[i].valid = false;
-        }
+        release_entry(bus, &bus->entries[i]);
     }
     bus->count = 0;
+    hive_arena_free(&s_bus_arena, bus->entries);
+    bus->entries = NULL;
+    bus->slab = NULL;
 }
 
 // Expire old entries based on max_age_ms
@@ -141,8 +458,7 @@ static void expire_old_entries(bus_t *bus) {
         }
 
         // Expire this entry
-        hive_msg_pool_free(entry->data);
-        entry->valid = false;
+        release_entry(bus, entry);
         bus->tail = (bus->tail + 1) % bus->config.max_entries;
         bus->count--;
     }
@@ -155,9 +471,15 @@ hive_status hive_bus_init(void) {
     // Use static bus array (already zero-initialized)
     s_bus_table.buses = s_buses;
     s_bus_table.max_buses = HIVE_MAX_BUSES;
-    s_bus_table.next_id = 1;
     s_bus_table.initialized = true;
 
+    hive_arena_init(&s_bus_arena, s_bus_arena_memory, HIVE_BUS_ARENA_SIZE);
+    hive_pool_init(&s_subscriber_pool_mgr, s_subscriber_pool,
+                   s_subscriber_used, sizeof(bus_subscriber),
+                   HIVE_BUS_SUBSCRIBER_POOL_SIZE);
+    hive_pool_init(&s_filter_pool_mgr, s_filter_pool, s_filter_used,
+                   sizeof(bus_sub_filter), HIVE_BUS_FILTER_POOL_SIZE);
+
     return HIVE_SUCCESS;
 }
 
@@ -172,8 +494,6 @@ void hive_bus_cleanup(void) {
         bus_t *bus = &s_bus_table.buses[i];
         if (bus->active) {
             free_bus_entries(bus);
-            // Note: bus->entries and bus->subscribers point to static arrays,
-            // no free needed
             bus->active = false;
         }
     }
@@ -185,26 +505,20 @@ void hive_bus_cleanup(void) {
 }
 
 // Cleanup actor bus subscriptions (called when actor dies)
-void hive_bus_cleanup_actor(actor_id id) {
+void hive_bus_cleanup_actor(actor *a) {
     if (!s_bus_table.initialized) {
         return;
     }
 
-    for (size_t i = 0; i < s_bus_table.max_buses; i++) {
-        bus_t *bus = &s_bus_table.buses[i];
-        if (!bus->active) {
-            continue;
-        }
+    while (a->bus_subs) {
+        HIVE_LOG_DEBUG("Actor %u unsubscribed from bus %u (cleanup)", a->id,
+                       a->bus_subs->bus->id);
+        remove_subscriber(a->bus_subs);
+    }
 
-        // Remove actor from subscribers
-        for (size_t j = 0; j < bus->config.max_subscribers; j++) {
-            if (bus->subscribers[j].active && bus->subscribers[j].id == id) {
-                bus->subscribers[j].active = false;
-                bus->num_subscribers--;
-                HIVE_LOG_DEBUG("Actor %u unsubscribed from bus %u (cleanup)",
-                               id, bus->id);
-            }
-        }
+    // Killed while waiting to publish
+    if (a->bus_pub_wait) {
+        pub_waiter_unlink(a->bus_pub_wait);
     }
 }
 
@@ -218,13 +532,33 @@ hive_status hive_bus_create(const hive_bus_config *cfg, bus_id *out) {
         return HIVE_ERROR(HIVE_ERR_INVALID, "Bus subsystem not initialized");
     }
 
-    if (cfg->max_entries == 0 || cfg->max_entry_size == 0 ||
-        cfg->max_subscribers == 0) {
+    bool latest = cfg->mode == HIVE_BUS_LATEST;
+    if ((!latest && cfg->max_entries == 0) || cfg->max_entry_size == 0 ||
+        cfg->max_subscribers == 0 ||
+        (cfg->mode != HIVE_BUS_RING && !latest)) {
         return HIVE_ERROR(HIVE_ERR_INVALID, "Invalid bus configuration");
     }
 
+    // Only entries every subscriber has read may leave a lossless bus
+    if (cfg->overflow == HIVE_BUS_OVERFLOW_BLOCK &&
+        (latest || cfg->consume_after_reads > 0 || cfg->max_age_ms > 0)) {
+        return HIVE_ERROR(HIVE_ERR_INVALID,
+                          "Lossless bus needs a ring without consume or "
+                          "expiry");
+    }
+    if (cfg->overflow != HIVE_BUS_OVERFLOW_EVICT &&
+        cfg->overflow != HIVE_BUS_OVERFLOW_BLOCK) {
+        return HIVE_ERROR(HIVE_ERR_INVALID, "Invalid overflow policy");
+    }
+
+    // Nothing to count reads against: the slot is overwritten, not consumed
+    if (latest && cfg->consume_after_reads > 0) {
+        return HIVE_ERROR(HIVE_ERR_INVALID,
+                          "consume_after_reads on a latest-value bus");
+    }
+
     // Validate against compile-time limits
-    if (cfg->max_entries > HIVE_MAX_BUS_ENTRIES) {
+    if (!latest && cfg->max_entries > HIVE_MAX_BUS_ENTRIES) {
         return HIVE_ERROR(HIVE_ERR_INVALID,
                           "max_entries exceeds HIVE_MAX_BUS_ENTRIES");
     }
@@ -254,12 +588,28 @@ hive_status hive_bus_create(const hive_bus_config *cfg, bus_id *out) {
         return HIVE_ERROR(HIVE_ERR_NOMEM, "Bus table full");
     }
 
-    // Initialize bus using static arrays
+    // A latest-value bus is a one-entry ring that publish overwrites
+    size_t max_entries = latest ? 1 : cfg->max_entries;
+
+    // One block per bus: entry descriptors, then the payload slab
+    size_t stride = (cfg->max_entry_size + 7) & ~(size_t)7;
+    bus_entry *entries = hive_arena_alloc(
+        &s_bus_arena, max_entries * (sizeof(bus_entry) + stride));
+    if (!entries) {
+        return HIVE_ERROR(HIVE_ERR_NOMEM, "Bus arena exhausted");
+    }
+    memset(entries, 0, max_entries * sizeof(bus_entry));
+
+    // Initialize bus (the slot's last id survives destroy for the generation)
+    bus_id prev_id = bus->id;
     memset(bus, 0, sizeof(bus_t));
-    bus->id = s_bus_table.next_id++;
+    bus->id = next_bus_id(bus_idx, prev_id);
     bus->config = *cfg;
-    bus->entries = s_bus_entries[bus_idx];
-    bus->subscribers = s_bus_subscribers[bus_idx];
+    bus->config.max_entries = max_entries;
+    bus->entries = entries;
+    bus->slab = (uint8_t *)(entries + max_entries);
+    bus->stride = stride;
+    bus->blocked = NULL;
     bus->head = 0;
     bus->tail = 0;
     bus->count = 0;
@@ -287,15 +637,133 @@ hive_status hive_bus_destroy(bus_id id) {
                           "Cannot destroy bus with active subscribers");
     }
 
+    // Publishers still waiting for space get "Bus not found" on retry
+    while (bus->pub_waiters) {
+        bus_pub_waiter *w = bus->pub_waiters;
+        if (w->owner->state == ACTOR_STATE_WAITING) {
+            w->owner->state = ACTOR_STATE_READY;
+        }
+        pub_waiter_unlink(w);
+    }
+
     free_bus_entries(bus);
-    // Note: bus->entries and bus->subscribers point to static arrays, no free
-    // needed
     bus->active = false;
 
     HIVE_LOG_DEBUG("Destroyed bus %u", id);
     return HIVE_SUCCESS;
 }
 
+// Append one entry stamped now_ms. Returns HIVE_ERR_WOULDBLOCK on a full
+// lossless bus, or HIVE_ERR_NOMEM if the slot is borrowed and the message
+// pool is empty.
+static hive_status append_entry(bus_t *bus, const void *data, size_t len,
+                                uint64_t now_ms) {
+    // If buffer is full, evict oldest entry. A lossless bus has already
+    // freed every entry all subscribers passed, so the publisher waits.
+    if (bus->count >= bus->config.max_entries &&
+        bus->config.overflow == HIVE_BUS_OVERFLOW_BLOCK) {
+        return HIVE_ERROR(HIVE_ERR_WOULDBLOCK, "Bus full");
+    }
+    if (bus->count >= bus->config.max_entries) {
+        release_entry(bus, &bus->entries[bus->tail]);
+        bus->tail = (bus->tail + 1) % bus->config.max_entries;
+        bus->count--;
+    }
+
+    // Copy into this index's slab slot. If a reader still borrows that slot
+    // the new payload goes to a message pool buffer instead, so borrowed
+    // data never changes underneath it.
+    bus_entry *entry = &bus->entries[bus->head];
+    void *entry_data = slab_slot(bus, bus->head);
+    if (entry->leases > 0) {
+        message_data_entry *msg_data = hive_msg_pool_alloc();
+        if (!msg_data) {
+            return HIVE_ERROR(HIVE_ERR_NOMEM, "Message pool exhausted");
+        }
+        entry_data = msg_data->data;
+    }
+    memcpy(entry_data, data, len);
+
+    // Add new entry
+    entry->data = entry_data;
+    entry->len = len;
+    entry->seq = bus->next_seq++;
+    entry->timestamp_ms = now_ms;
+    entry->read_count = 0;
+    entry->pending = (uint16_t)bus->num_subscribers;
+    entry->valid = true;
+
+    bus->head = (bus->head + 1) % bus->config.max_entries;
+    bus->count++;
+
+    HIVE_LOG_TRACE("Published %zu bytes to bus %u (count=%zu)", len, bus->id,
+                   bus->count);
+    return HIVE_SUCCESS;
+}
+
+// Wake up blocked subscribers (only those waiting are on the list) whose
+// filters pass one of the entries from first_seq on; the rest sleep through
+// them. A waiting subscriber has read everything before these entries, so
+// rejected ones are stepped over here and never looked at again.
+static void wake_subscribers(bus_t *bus, uint64_t first_seq) {
+    uint64_t oldest = bus->next_seq - bus->count;
+    if (first_seq < oldest) {
+        first_seq = oldest; // Batch larger than the ring
+    }
+    for (bus_subscriber *sub = bus->blocked; sub; sub = sub->blocked_next) {
+        actor *a = sub->owner;
+        if (a->state != ACTOR_STATE_WAITING) {
+            continue;
+        }
+        if (rate_limited(sub)) {
+            // Held back: no wakeup now, but one when the interval ends
+            if (a->select_sources) {
+                hive_select_wake_at(a, sub->opts->next_delivery_us);
+            }
+            continue;
+        }
+        bool wanted = false;
+        for (uint64_t seq = first_seq; seq < bus->next_seq && !wanted;
+             seq++) {
+            bus_entry *e = &bus->entries[seq % bus->config.max_entries];
+            if (!e->valid) {
+                continue; // Lossless bus: every subscriber passed it
+            }
+            if (accepts(sub, e)) {
+                wanted = true;
+            } else if (sub->cursor == seq) {
+                advance_cursor(bus, sub, seq + 1);
+            }
+        }
+        if (!wanted) {
+            continue;
+        }
+        // Check if using hive_select
+        if (a->select_sources) {
+            // Check if this bus is in select sources
+            for (size_t j = 0; j < a->select_source_count; j++) {
+                if (a->select_sources[j].type == HIVE_SEL_BUS &&
+                    a->select_sources[j].bus == bus->id) {
+                    a->state = ACTOR_STATE_READY;
+                    HIVE_LOG_TRACE("Woke select subscriber %u on bus %u",
+                                   a->id, bus->id);
+                    break;
+                }
+            }
+        } else {
+            // Legacy single-bus wait
+            a->state = ACTOR_STATE_READY;
+            HIVE_LOG_TRACE("Woke blocked subscriber %u on bus %u", a->id,
+                           bus->id);
+        }
+    }
+
+    // Lossless bus with nobody subscribed: nothing will ever read it
+    if (bus->config.overflow == HIVE_BUS_OVERFLOW_BLOCK) {
+        trim_passed(bus);
+    }
+}
+
 // Publish data
 hive_status hive_bus_publish(bus_id id, const void *data, size_t len) {
     if (!data || len == 0) {
@@ -320,74 +788,125 @@ hive_status hive_bus_publish(bus_id id, const void *data, size_t len) {
                           "Message exceeds HIVE_MAX_MESSAGE_SIZE");
     }
 
-    // If buffer is full, evict oldest entry
-    if (bus->count >= bus->config.max_entries) {
-        bus_entry *oldest = &bus->entries[bus->tail];
-        if (oldest->valid) {
-            hive_msg_pool_free(oldest->data);
-        }
-        oldest->valid = false;
-        bus->tail = (bus->tail + 1) % bus->config.max_entries;
-        bus->count--;
+    uint64_t seq = bus->next_seq;
+    hive_status s = append_entry(bus, data, len, get_time_ms());
+    if (HIVE_FAILED(s)) {
+        return s;
     }
+    wake_subscribers(bus, seq);
+    return HIVE_SUCCESS;
+}
 
-    // Allocate from message pool and copy data
-    message_data_entry *msg_data = hive_pool_alloc(&g_message_pool_mgr);
-    if (!msg_data) {
-        return HIVE_ERROR(HIVE_ERR_NOMEM, "Message pool exhausted");
+// Publish several entries with one expiry pass and one wakeup pass
+hive_status hive_bus_publish_batch(bus_id id, const void *data,
+                                   size_t entry_stride, const size_t *lens,
+                                   size_t count, size_t *published) {
+    if (published) {
+        *published = 0;
+    }
+    if (!data || !lens || count == 0) {
+        return HIVE_ERROR(HIVE_ERR_INVALID, "Invalid data");
     }
-    memcpy(msg_data->data, data, len);
-    void *entry_data = msg_data->data;
 
-    // Add new entry
-    bus_entry *entry = &bus->entries[bus->head];
-    entry->data = entry_data;
-    entry->len = len;
-    entry->timestamp_ms = get_time_ms();
-    entry->read_count = 0;
-    entry->readers_mask = 0;
-    entry->valid = true;
+    bus_t *bus = find_bus(id);
+    if (!bus) {
+        return HIVE_ERROR(HIVE_ERR_INVALID, "Bus not found");
+    }
 
-    bus->head = (bus->head + 1) % bus->config.max_entries;
-    bus->count++;
+    // Reject the whole batch up front rather than publish part of it
+    for (size_t i = 0; i < count; i++) {
+        if (lens[i] == 0 || lens[i] > entry_stride ||
+            lens[i] > bus->config.max_entry_size) {
+            return HIVE_ERROR(HIVE_ERR_INVALID, "Invalid entry length");
+        }
+    }
 
-    HIVE_LOG_TRACE("Published %zu bytes to bus %u (count=%zu)", len, id,
-                   bus->count);
+    expire_old_entries(bus);
 
-    // Wake up any blocked subscribers
-    for (size_t i = 0; i < bus->config.max_subscribers; i++) {
-        bus_subscriber *sub = &bus->subscribers[i];
-        if (sub->active && sub->blocked) {
-            actor *a = hive_actor_get(sub->id);
-            if (a && a->state == ACTOR_STATE_WAITING) {
-                // Check if using hive_select
-                if (a->select_sources) {
-                    // Check if this bus is in select sources
-                    for (size_t j = 0; j < a->select_source_count; j++) {
-                        if (a->select_sources[j].type == HIVE_SEL_BUS &&
-                            a->select_sources[j].bus == bus->id) {
-                            a->state = ACTOR_STATE_READY;
-                            HIVE_LOG_TRACE(
-                                "Woke select subscriber %u on bus %u", sub->id,
-                                id);
-                            break;
-                        }
-                    }
-                } else {
-                    // Legacy single-bus wait
-                    a->state = ACTOR_STATE_READY;
-                    HIVE_LOG_TRACE("Woke blocked subscriber %u on bus %u",
-                                   sub->id, id);
-                }
-            }
+    // A full lossless bus or an empty message pool stops the batch; the
+    // entries already appended stay published. One timestamp for all.
+    uint64_t now_ms = get_time_ms();
+    uint64_t first_seq = bus->next_seq;
+    const uint8_t *src = data;
+    hive_status s = HIVE_SUCCESS;
+    size_t i = 0;
+    for (; i < count; i++) {
+        s = append_entry(bus, src + i * entry_stride, lens[i], now_ms);
+        if (HIVE_FAILED(s)) {
+            break;
         }
     }
+    if (i > 0) {
+        wake_subscribers(bus, first_seq);
+    }
+    if (published) {
+        *published = i;
+    }
+    return s;
+}
 
-    return HIVE_SUCCESS;
+// Publish with back-pressure
+hive_status hive_bus_publish_wait(bus_id id, const void *data, size_t len,
+                                  int32_t timeout_ms) {
+    return hive_bus_publish_wait_until(id, data, len,
+                                       hive_deadline_after_ms(timeout_ms));
+}
+
+hive_status hive_bus_publish_wait_until(bus_id id, const void *data,
+                                        size_t len, uint64_t deadline_us) {
+    hive_status s = hive_bus_publish(id, data, len);
+    if (s.code != HIVE_ERR_WOULDBLOCK || deadline_us == HIVE_DEADLINE_NOW) {
+        return s;
+    }
+
+    HIVE_REQUIRE_ACTOR_CONTEXT();
+    actor *current = hive_actor_current();
+    bool timed = deadline_us != HIVE_DEADLINE_NONE;
+    if (timed && hive_get_time() >= deadline_us) {
+        return HIVE_ERROR(HIVE_ERR_TIMEOUT, "Publish deadline passed");
+    }
+
+    // Wait on the bus's publisher list (the node lives on this stack)
+    // until a read frees an entry, then retry. Another publisher may take
+    // the space first, in which case this one waits again.
+    bus_t *bus = find_bus(id);
+    bus_pub_waiter waiter = {.bus = bus, .owner = current};
+    waiter.next = bus->pub_waiters;
+    if (waiter.next) {
+        waiter.next->prev = &waiter;
+    }
+    bus->pub_waiters = &waiter;
+    current->bus_pub_wait = &waiter;
+
+    if (timed) {
+        hive_timer_deadline_arm(current, deadline_us);
+    }
+    for (;;) {
+        current->state = ACTOR_STATE_WAITING;
+        hive_scheduler_yield();
+        s = hive_bus_publish(id, data, len);
+        if (s.code != HIVE_ERR_WOULDBLOCK) {
+            break;
+        }
+        if (timed && !hive_timer_deadline_pending(current)) {
+            s = HIVE_ERROR(HIVE_ERR_TIMEOUT, "Publish timeout");
+            break;
+        }
+    }
+    if (timed) {
+        hive_timer_deadline_cancel(current);
+    }
+    pub_waiter_unlink(&waiter);
+    return s;
 }
 
 // Subscribe current actor
 hive_status hive_bus_subscribe(bus_id id) {
+    return hive_bus_subscribe_ex(id, NULL);
+}
+
+// Subscribe current actor with delivery filters
+hive_status hive_bus_subscribe_ex(bus_id id, const hive_bus_sub_opts *opts) {
     bus_t *bus = find_bus(id);
     if (!bus) {
         return HIVE_ERROR(HIVE_ERR_INVALID, "Bus not found");
@@ -397,28 +916,52 @@ hive_status hive_bus_subscribe(bus_id id) {
     actor *current = hive_actor_current();
 
     // Check if already subscribed
-    if (find_subscriber(bus, current->id) >= 0) {
+    if (find_subscriber(bus, current)) {
         return HIVE_ERROR(HIVE_ERR_INVALID, "Already subscribed");
     }
 
-    // Find free subscriber slot
-    bus_subscriber *sub = NULL;
-    for (size_t i = 0; i < bus->config.max_subscribers; i++) {
-        if (!bus->subscribers[i].active) {
-            sub = &bus->subscribers[i];
-            break;
+    if (bus->num_subscribers >= bus->config.max_subscribers) {
+        return HIVE_ERROR(HIVE_ERR_NOMEM, "Subscriber table full");
+    }
+
+    // Only subscriptions that filter need a filter node
+    bus_sub_filter *f = NULL;
+    if (opts && (opts->decimation > 1 || opts->min_interval_us > 0 ||
+                 opts->filter || opts->field.op != HIVE_BUS_CMP_NONE)) {
+        f = hive_pool_alloc(&s_filter_pool_mgr);
+        if (!f) {
+            return HIVE_ERROR(HIVE_ERR_NOMEM, "Bus filter pool exhausted");
         }
+        f->phase = bus->next_seq;
+        f->next_delivery_us = 0;
+        f->decimation = opts->decimation;
+        f->min_interval_us = opts->min_interval_us;
+        f->filter = opts->filter;
+        f->filter_ctx = opts->filter_ctx;
+        f->field = opts->field;
+        f->passed_seq = 0;
     }
 
+    bus_subscriber *sub = hive_pool_alloc(&s_subscriber_pool_mgr);
     if (!sub) {
-        return HIVE_ERROR(HIVE_ERR_NOMEM, "Subscriber table full");
+        if (f) {
+            hive_pool_free(&s_filter_pool_mgr, f);
+        }
+        return HIVE_ERROR(HIVE_ERR_NOMEM, "Bus subscriber pool exhausted");
     }
 
     // Initialize subscriber
-    sub->id = current->id;
-    sub->next_read_idx = bus->head; // Start reading from newest entry
-    sub->active = true;
+    sub->bus = bus;
+    sub->owner = current;
+    sub->cursor = bus->next_seq; // Start at the next publish
+    sub->missed = 0;
+    sub->lease = NULL;
+    sub->opts = f;
     sub->blocked = false;
+    sub->blocked_next = NULL;
+    sub->blocked_prev = NULL;
+    sub->next = current->bus_subs;
+    current->bus_subs = sub;
     bus->num_subscribers++;
 
     HIVE_LOG_DEBUG("Actor %u subscribed to bus %u", current->id, id);
@@ -436,19 +979,46 @@ hive_status hive_bus_unsubscribe(bus_id id) {
     HIVE_REQUIRE_ACTOR_CONTEXT();
     actor *current = hive_actor_current();
 
-    int sub_idx = find_subscriber(bus, current->id);
-    if (sub_idx < 0) {
+    bus_subscriber *sub = find_subscriber(bus, current);
+    if (!sub) {
         return HIVE_ERROR(HIVE_ERR_INVALID, "Not subscribed");
     }
 
-    bus->subscribers[sub_idx].active = false;
-    bus->num_subscribers--;
+    remove_subscriber(sub);
 
     HIVE_LOG_DEBUG("Actor %u unsubscribed from bus %u", current->id, id);
 
     return HIVE_SUCCESS;
 }
 
+// Count a subscriber's read of its next entry and move its cursor past it;
+// with consume_after_reads the entry is freed once enough readers saw it
+static void mark_read(bus_t *bus, bus_subscriber *sub, bus_entry *entry) {
+    // The cursor moves past the entry, so each subscriber counts once
+    entry->read_count++;
+    advance_cursor(bus, sub, sub->cursor + 1);
+    bus_sub_filter *f = sub->opts;
+    if (f && f->min_interval_us > 0) {
+        f->next_delivery_us = hive_get_time_coarse() + f->min_interval_us;
+    }
+
+    if (bus->config.consume_after_reads > 0 &&
+        entry->read_count >= bus->config.consume_after_reads) {
+        release_entry(bus, entry);
+
+        // Advance tail if this was the tail entry
+        if ((size_t)(entry - bus->entries) == bus->tail) {
+            while (bus->count > 0 && !bus->entries[bus->tail].valid) {
+                bus->tail = (bus->tail + 1) % bus->config.max_entries;
+                bus->count--;
+            }
+        }
+
+        HIVE_LOG_TRACE("Bus %u entry consumed by %u readers", bus->id,
+                       entry->read_count);
+    }
+}
+
 // Read entry (non-blocking)
 hive_status hive_bus_read(bus_id id, void *buf, size_t max_len,
                           size_t *actual_len) {
@@ -465,39 +1035,17 @@ hive_status hive_bus_read(bus_id id, void *buf, size_t max_len,
     HIVE_REQUIRE_ACTOR_CONTEXT();
     actor *current = hive_actor_current();
 
-    int sub_idx = find_subscriber(bus, current->id);
-    if (sub_idx < 0) {
+    bus_subscriber *sub = find_subscriber(bus, current);
+    if (!sub) {
         return HIVE_ERROR(HIVE_ERR_INVALID, "Not subscribed");
     }
 
-    bus_subscriber *sub = &bus->subscribers[sub_idx];
+    release_lease(sub);
 
     // Expire old entries
     expire_old_entries(bus);
 
-    // Find next unread entry
-    size_t idx = sub->next_read_idx;
-    bus_entry *entry = NULL;
-
-    // Search for next valid unread entry
-    for (size_t i = 0; i < bus->count; i++) {
-        size_t check_idx = (bus->tail + i) % bus->config.max_entries;
-        bus_entry *e = &bus->entries[check_idx];
-
-        if (!e->valid) {
-            continue;
-        }
-
-        // Check if this subscriber has already read this entry
-        if (e->readers_mask & (1u << sub_idx)) {
-            continue; // Already read
-        }
-
-        entry = e;
-        idx = check_idx;
-        break;
-    }
-
+    bus_entry *entry = next_unread(bus, sub);
     if (!entry) {
         return HIVE_ERROR(HIVE_ERR_WOULDBLOCK, "No data available");
     }
@@ -508,44 +1056,145 @@ hive_status hive_bus_read(bus_id id, void *buf, size_t max_len,
     memcpy(buf, entry->data, copy_len);
     *actual_len = copy_len; // Bytes actually copied
 
-    // Mark as read by this subscriber
-    entry->readers_mask |= (1u << sub_idx);
-    entry->read_count++;
-
-    // Update subscriber's next read position
-    sub->next_read_idx = (idx + 1) % bus->config.max_entries;
-
     HIVE_LOG_TRACE("Actor %u read %zu bytes from bus %u", current->id, copy_len,
                    id);
 
-    // Check if entry should be removed (max_readers)
-    if (bus->config.consume_after_reads > 0 &&
-        entry->read_count >= bus->config.consume_after_reads) {
-        hive_msg_pool_free(entry->data);
-        entry->valid = false;
-        entry->data = NULL;
+    mark_read(bus, sub, entry);
 
-        // Advance tail if this was the tail entry
-        if (idx == bus->tail) {
-            while (bus->count > 0 && !bus->entries[bus->tail].valid) {
-                bus->tail = (bus->tail + 1) % bus->config.max_entries;
-                bus->count--;
-            }
+    if (truncated) {
+        return HIVE_ERROR(HIVE_ERR_TRUNCATED, "Data truncated to fit buffer");
+    }
+    return HIVE_SUCCESS;
+}
+
+// Read every pending entry up to max_entries (non-blocking)
+hive_status hive_bus_read_batch(bus_id id, void *buf, size_t entry_stride,
+                                size_t max_entries, size_t *lens, size_t *n) {
+    if (!buf || !lens || !n) {
+        return HIVE_ERROR(HIVE_ERR_INVALID, "NULL buffer, lens or n pointer");
+    }
+    *n = 0;
+
+    bus_t *bus = find_bus(id);
+    if (!bus) {
+        return HIVE_ERROR(HIVE_ERR_INVALID, "Bus not found");
+    }
+
+    HIVE_REQUIRE_ACTOR_CONTEXT();
+    actor *current = hive_actor_current();
+
+    bus_subscriber *sub = find_subscriber(bus, current);
+    if (!sub) {
+        return HIVE_ERROR(HIVE_ERR_INVALID, "Not subscribed");
+    }
+
+    release_lease(sub);
+    expire_old_entries(bus);
+
+    // Entry i goes to buf + i * entry_stride, truncated to entry_stride
+    uint8_t *dst = buf;
+    bool truncated = false;
+    size_t count = 0;
+    bus_entry *entry;
+    while (count < max_entries && (entry = next_unread(bus, sub))) {
+        size_t copy_len = entry->len;
+        if (copy_len > entry_stride) {
+            copy_len = entry_stride;
+            truncated = true;
         }
+        memcpy(dst + count * entry_stride, entry->data, copy_len);
+        lens[count++] = copy_len;
+        mark_read(bus, sub, entry);
+    }
+    *n = count;
 
-        HIVE_LOG_TRACE("Bus %u entry consumed by %u readers", id,
-                       entry->read_count);
+    if (count == 0) {
+        return HIVE_ERROR(HIVE_ERR_WOULDBLOCK, "No data available");
     }
 
+    HIVE_LOG_TRACE("Actor %u read %zu entries from bus %u", current->id, count,
+                   id);
+
     if (truncated) {
-        return HIVE_ERROR(HIVE_ERR_TRUNCATED, "Data truncated to fit buffer");
+        return HIVE_ERROR(HIVE_ERR_TRUNCATED, "Data truncated to fit stride");
     }
     return HIVE_SUCCESS;
 }
 
+// Borrow the next entry (non-blocking, no copy)
+hive_status hive_bus_read_ref(bus_id id, const void **data, size_t *len) {
+    if (!data || !len) {
+        return HIVE_ERROR(HIVE_ERR_INVALID, "NULL data or len pointer");
+    }
+
+    bus_t *bus = find_bus(id);
+    if (!bus) {
+        return HIVE_ERROR(HIVE_ERR_INVALID, "Bus not found");
+    }
+
+    HIVE_REQUIRE_ACTOR_CONTEXT();
+    actor *current = hive_actor_current();
+
+    bus_subscriber *sub = find_subscriber(bus, current);
+    if (!sub) {
+        return HIVE_ERROR(HIVE_ERR_INVALID, "Not subscribed");
+    }
+
+    release_lease(sub);
+    expire_old_entries(bus);
+
+    bus_entry *entry = next_unread(bus, sub);
+    if (!entry) {
+        return HIVE_ERROR(HIVE_ERR_WOULDBLOCK, "No data available");
+    }
+
+    // While the lease lasts, publish leaves the slab slot alone, and a pool
+    // buffer keeps the lease's reference through eviction, expiry or
+    // consumption of the entry
+    if (in_slab(bus, entry->data)) {
+        entry->leases++;
+    } else {
+        hive_msg_pool_ref(entry->data);
+    }
+    sub->lease = entry->data;
+    *data = entry->data;
+    *len = entry->len;
+
+    HIVE_LOG_TRACE("Actor %u borrowed %zu bytes from bus %u", current->id,
+                   entry->len, id);
+
+    mark_read(bus, sub, entry);
+    return HIVE_SUCCESS;
+}
+
+// Return a borrowed entry before the next read
+hive_status hive_bus_release(bus_id id) {
+    bus_t *bus = find_bus(id);
+    if (!bus) {
+        return HIVE_ERROR(HIVE_ERR_INVALID, "Bus not found");
+    }
+
+    HIVE_REQUIRE_ACTOR_CONTEXT();
+
+    bus_subscriber *sub = find_subscriber(bus, hive_actor_current());
+    if (!sub) {
+        return HIVE_ERROR(HIVE_ERR_INVALID, "Not subscribed");
+    }
+
+    release_lease(sub);
+    return HIVE_SUCCESS;
+}
+
 // Read with blocking - wrapper around hive_select
 hive_status hive_bus_read_wait(bus_id id, void *buf, size_t max_len,
                                size_t *actual_len, int32_t timeout_ms) {
+    return hive_bus_read_wait_until(id, buf, max_len, actual_len,
+                                    hive_deadline_after_ms(timeout_ms));
+}
+
+hive_status hive_bus_read_wait_until(bus_id id, void *buf, size_t max_len,
+                                     size_t *actual_len,
+                                     uint64_t deadline_us) {
     if (!buf || !actual_len) {
         return HIVE_ERROR(HIVE_ERR_INVALID,
                           "NULL buffer or actual_len pointer");
@@ -556,14 +1205,114 @@ hive_status hive_bus_read_wait(bus_id id, void *buf, size_t max_len,
     // Use hive_select with single bus source
     hive_select_source source = {.type = HIVE_SEL_BUS, .bus = id};
     hive_select_result result;
-    hive_status s = hive_select(&source, 1, &result, timeout_ms);
-    if (HIVE_SUCCEEDED(s)) {
-        // Copy data to user buffer
-        size_t copy_len = result.bus.len < max_len ? result.bus.len : max_len;
-        memcpy(buf, result.bus.data, copy_len);
-        *actual_len = copy_len;
+    hive_status s = hive_select_until(&source, 1, &result, deadline_us);
+    if (HIVE_FAILED(s)) {
+        return s;
     }
-    return s;
+
+    // Copy the borrowed entry to the user buffer (the only copy)
+    bool truncated = result.bus.len > max_len;
+    size_t copy_len = truncated ? max_len : result.bus.len;
+    memcpy(buf, result.bus.data, copy_len);
+    *actual_len = copy_len;
+    hive_bus_release(id);
+
+    if (truncated) {
+        return HIVE_ERROR(HIVE_ERR_TRUNCATED, "Data truncated to fit buffer");
+    }
+    return HIVE_SUCCESS;
+}
+
+// Read the newest value of a latest-value bus, new or not
+hive_status hive_bus_read_latest(bus_id id, void *buf, size_t max_len,
+                                 size_t *actual_len, bool *fresh) {
+    if (!buf || !actual_len) {
+        return HIVE_ERROR(HIVE_ERR_INVALID,
+                          "NULL buffer or actual_len pointer");
+    }
+
+    bus_t *bus = find_bus(id);
+    if (!bus) {
+        return HIVE_ERROR(HIVE_ERR_INVALID, "Bus not found");
+    }
+
+    if (bus->config.mode != HIVE_BUS_LATEST) {
+        return HIVE_ERROR(HIVE_ERR_INVALID, "Not a latest-value bus");
+    }
+
+    HIVE_REQUIRE_ACTOR_CONTEXT();
+    actor *current = hive_actor_current();
+
+    bus_subscriber *sub = find_subscriber(bus, current);
+    if (!sub) {
+        return HIVE_ERROR(HIVE_ERR_INVALID, "Not subscribed");
+    }
+
+    release_lease(sub);
+    expire_old_entries(bus);
+
+    bus_entry *slot = &bus->entries[0];
+    if (!slot->valid) {
+        return HIVE_ERROR(HIVE_ERR_WOULDBLOCK, "No data available");
+    }
+
+    // Unread only if published since the last read; the versions in between
+    // were overwritten unseen and count as missed. Freshness follows the
+    // cursor alone: a rate limit paces waiting reads, not this one.
+    bool is_new = false;
+    if (sub->cursor < bus->next_seq) {
+        if (sub->cursor < slot->seq) {
+            sub->missed += slot->seq - sub->cursor;
+            advance_cursor(bus, sub, slot->seq);
+        }
+        is_new = accepts(sub, slot);
+        if (is_new) {
+            mark_read(bus, sub, slot);
+        } else {
+            advance_cursor(bus, sub, bus->next_seq);
+        }
+    }
+    if (fresh) {
+        *fresh = is_new;
+    }
+
+    bool truncated = slot->len > max_len;
+    size_t copy_len = truncated ? max_len : slot->len;
+    memcpy(buf, slot->data, copy_len);
+    *actual_len = copy_len;
+
+    if (truncated) {
+        return HIVE_ERROR(HIVE_ERR_TRUNCATED, "Data truncated to fit buffer");
+    }
+    return HIVE_SUCCESS;
+}
+
+// Entries the current subscriber skipped since the previous call
+hive_status hive_bus_missed(bus_id id, uint64_t *missed) {
+    if (!missed) {
+        return HIVE_ERROR(HIVE_ERR_INVALID, "NULL missed pointer");
+    }
+
+    bus_t *bus = find_bus(id);
+    if (!bus) {
+        return HIVE_ERROR(HIVE_ERR_INVALID, "Bus not found");
+    }
+
+    HIVE_REQUIRE_ACTOR_CONTEXT();
+    actor *current = hive_actor_current();
+
+    bus_subscriber *sub = find_subscriber(bus, current);
+    if (!sub) {
+        return HIVE_ERROR(HIVE_ERR_INVALID, "Not subscribed");
+    }
+
+    // Count entries lost so far, not only up to the last read
+    expire_old_entries(bus);
+    next_unread(bus, sub);
+
+    *missed = sub->missed;
+    sub->missed = 0;
+    return HIVE_SUCCESS;
 }
 
 // Query bus state
@@ -592,32 +1341,31 @@ bool hive_bus_has_data(bus_id id) {
         return false;
     }
 
-    int sub_idx = find_subscriber(bus, current->id);
-    if (sub_idx < 0) {
+    bus_subscriber *sub = find_subscriber(bus, current);
+    if (!sub) {
         return false;
     }
 
     // Expire old entries
     expire_old_entries(bus);
 
-    // Check for unread entry
-    for (size_t i = 0; i < bus->count; i++) {
-        size_t check_idx = (bus->tail + i) % bus->config.max_entries;
-        bus_entry *e = &bus->entries[check_idx];
-
-        if (!e->valid) {
-            continue;
-        }
-
-        // Check if this subscriber has already read this entry
-        if (e->readers_mask & (1u << sub_idx)) {
-            continue; // Already read
-        }
+    return next_unread(bus, sub) != NULL;
+}
 
-        return true; // Found unread data
+// When a rate-limited subscription's unread entries become readable
+bool hive_bus_held_until(bus_id id, uint64_t *at_us) {
+    bus_t *bus = find_bus(id);
+    actor *current = hive_actor_current();
+    if (!bus || !current) {
+        return false;
     }
 
-    return false;
+    bus_subscriber *sub = find_subscriber(bus, current);
+    if (!sub || sub->cursor >= bus->next_seq || !rate_limited(sub)) {
+        return false;
+    }
+    *at_us = sub->opts->next_delivery_us;
+    return true;
 }
 
 // Set blocked flag for current actor on specified bus
@@ -632,12 +1380,22 @@ void hive_bus_set_blocked(bus_id id, bool blocked) {
         return;
     }
 
-    int sub_idx = find_subscriber(bus, current->id);
-    if (sub_idx < 0) {
+    bus_subscriber *sub = find_subscriber(bus, current);
+    if (!sub || sub->blocked == blocked) {
         return;
     }
 
-    bus->subscribers[sub_idx].blocked = blocked;
+    if (blocked) {
+        sub->blocked = true;
+        sub->blocked_prev = NULL;
+        sub->blocked_next = bus->blocked;
+        if (bus->blocked) {
+            bus->blocked->blocked_prev = sub;
+        }
+        bus->blocked = sub;
+    } else {
+        blocked_unlink(sub);
+    }
 }
 
 // Check if current actor is subscribed to bus
@@ -652,5 +1410,5 @@ bool hive_bus_is_subscribed(bus_id id) {
         return false;
     }
 
-    return find_subscriber(bus, current->id) >= 0;
+    return find_subscriber(bus, current) != NULL;
 }
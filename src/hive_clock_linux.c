@@ -0,0 +1,143 @@
+#include "hive_internal.h"
+#include "hive_static_config.h"
+#include "hive_log.h"
+#include <stdbool.h>
+#include <stdint.h>
+#include <time.h>
+#if HIVE_CLOCK_TSC && defined(__x86_64__)
+#include <cpuid.h>
+#endif
+
+// Monotonic microsecond clock behind hive_get_time() and every runtime
+// timestamp. On x86-64 with an invariant TSC, reads are a rdtsc plus a
+// multiply, extrapolated from the last CLOCK_MONOTONIC sample. The cycle
+// rate is measured against CLOCK_MONOTONIC over an ever longer baseline,
+// and the clock re-syncs every HIVE_CLOCK_TSC_RESYNC_US, so it never
+// strays far from the timerfd timebase. Elsewhere, and until the first
+// calibration window has passed, it reads vDSO clock_gettime.
+
+// Calibration window before the TSC is trusted
+#define TSC_CALIBRATE_US 10000
+
+static struct {
+    bool initialized;
+    bool tsc;                // TSC path active (calibrated)
+    bool tsc_capable;        // Invariant TSC present, calibration pending
+    uint64_t anchor_tsc;     // First sample: long calibration baseline
+    uint64_t anchor_us;
+    uint64_t base_tsc;       // Last re-sync point
+    uint64_t base_us;
+    uint64_t resync_cycles;  // Extrapolate at most this far from base
+    double us_per_cycle;
+    uint64_t last_us;        // Never step backwards across re-syncs
+} s_clock = {0};
+
+static uint64_t monotonic_us(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * HIVE_USEC_PER_SEC +
+           (uint64_t)ts.tv_nsec / 1000;
+}
+
+#if HIVE_CLOCK_TSC && defined(__x86_64__)
+static inline uint64_t read_tsc(void) {
+    uint32_t lo, hi;
+    __asm__ __volatile__("rdtsc" : "=a"(lo), "=d"(hi));
+    return (uint64_t)hi << 32 | lo;
+}
+
+// CPUID.80000007H:EDX[8]: TSC runs at a constant rate in all C/P-states
+static bool tsc_invariant(void) {
+    unsigned int eax, ebx, ecx, edx;
+    if (!__get_cpuid(0x80000000, &eax, &ebx, &ecx, &edx) ||
+        eax < 0x80000007) {
+        return false;
+    }
+    __get_cpuid(0x80000007, &eax, &ebx, &ecx, &edx);
+    return (edx & (1u << 8)) != 0;
+}
+
+// Re-sync to CLOCK_MONOTONIC and refine the rate over the full baseline
+static void tsc_sync(uint64_t tsc) {
+    uint64_t now = monotonic_us();
+    uint64_t cycles = tsc - s_clock.anchor_tsc;
+    if (cycles > 0 && now > s_clock.anchor_us) {
+        s_clock.us_per_cycle =
+            (double)(now - s_clock.anchor_us) / (double)cycles;
+        s_clock.resync_cycles =
+            (uint64_t)(HIVE_CLOCK_TSC_RESYNC_US / s_clock.us_per_cycle);
+    }
+    s_clock.base_tsc = tsc;
+    s_clock.base_us = now;
+}
+#endif
+
+static void clock_init(void) {
+    s_clock.initialized = true;
+#if HIVE_CLOCK_TSC && defined(__x86_64__)
+    if (tsc_invariant()) {
+        s_clock.tsc_capable = true;
+        s_clock.anchor_tsc = read_tsc();
+        s_clock.anchor_us = monotonic_us();
+    }
+#endif
+}
+
+uint64_t hive_clock_us(void) {
+    if (!s_clock.initialized) {
+        clock_init();
+    }
+
+#if HIVE_CLOCK_TSC && defined(__x86_64__)
+    if (s_clock.tsc) {
+        uint64_t tsc = read_tsc();
+        uint64_t cycles = tsc - s_clock.base_tsc;
+        if (cycles >= s_clock.resync_cycles) {
+            tsc_sync(tsc);
+            cycles = 0;
+        }
+        uint64_t now =
+            s_clock.base_us + (uint64_t)((double)cycles * s_clock.us_per_cycle);
+        if (now < s_clock.last_us) {
+            now = s_clock.last_us; // Re-sync landed behind an extrapolation
+        }
+        s_clock.last_us = now;
+        return now;
+    }
+
+    if (s_clock.tsc_capable) {
+        uint64_t now = monotonic_us();
+        if (now - s_clock.anchor_us >= TSC_CALIBRATE_US) {
+            tsc_sync(read_tsc());
+            s_clock.tsc = true;
+            HIVE_LOG_DEBUG("Clock: invariant TSC, %.1f MHz",
+                           1.0 / s_clock.us_per_cycle);
+        }
+        s_clock.last_us = now;
+        return now;
+    }
+#endif
+
+    return monotonic_us();
+}
+
+// Between re-syncs the TSC path may run slightly ahead of or behind
+// CLOCK_MONOTONIC. Shift by the current offset so a timerfd fires when this
+// clock reaches the deadline: armed unconverted while the TSC lags, it
+// fires early and the scheduler spins on wakeups with nothing due.
+uint64_t hive_clock_to_monotonic(uint64_t clock_us) {
+    if (!s_clock.tsc) {
+        return clock_us;
+    }
+    uint64_t now = hive_clock_us();
+    uint64_t kernel = monotonic_us();
+    if (kernel >= now) {
+        return clock_us + (kernel - now);
+    }
+    uint64_t ahead = now - kernel;
+    return clock_us > ahead ? clock_us - ahead : 1;
+}
+
+bool hive_clock_is_tsc(void) {
+    return s_clock.tsc;
+}
@@ -0,0 +1,250 @@
+#include "hive_group.h"
+#include "hive_internal.h"
+#include "hive_static_config.h"
+#include "hive_pool.h"
+#include "hive_actor.h"
+#include "hive_log.h"
+#include <string.h>
+
+// Forward declaration for internal function
+void hive_group_cleanup_actor(actor_id id);
+
+// Group member (singly-linked list per group)
+// Holds the actor pointer directly: membership is removed in
+// hive_actor_free() before the actor slot is reused.
+typedef struct group_member {
+    actor *a;
+    struct group_member *next;
+} group_member;
+
+// Group structure
+typedef struct {
+    group_id id;
+    group_member *members;
+    size_t count;
+    bool active;
+} group_t;
+
+// Static group storage
+static group_t s_groups[HIVE_MAX_GROUPS];
+
+static group_member s_member_pool[HIVE_GROUP_MEMBER_POOL_SIZE];
+static bool s_member_used[HIVE_GROUP_MEMBER_POOL_SIZE];
+static hive_pool s_member_pool_mgr;
+
+// Group table
+static struct {
+    group_id next_id;
+    bool initialized;
+} s_group_table = {0};
+
+// Find group by ID
+static group_t *find_group(group_id id) {
+    if (id == GROUP_ID_INVALID) {
+        return NULL;
+    }
+
+    for (size_t i = 0; i < HIVE_MAX_GROUPS; i++) {
+        if (s_groups[i].active && s_groups[i].id == id) {
+            return &s_groups[i];
+        }
+    }
+
+    return NULL;
+}
+
+// Free all members of a group
+static void free_members(group_t *g) {
+    group_member *m = g->members;
+    while (m) {
+        group_member *next = m->next;
+        hive_pool_free(&s_member_pool_mgr, m);
+        m = next;
+    }
+    g->members = NULL;
+    g->count = 0;
+}
+
+// Initialize group subsystem
+hive_status hive_group_init(void) {
+    HIVE_INIT_GUARD(s_group_table.initialized);
+
+    hive_pool_init(&s_member_pool_mgr, s_member_pool, s_member_used,
+                   sizeof(group_member), HIVE_GROUP_MEMBER_POOL_SIZE);
+    memset(s_groups, 0, sizeof(s_groups));
+
+    s_group_table.next_id = 1;
+    s_group_table.initialized = true;
+
+    HIVE_LOG_DEBUG("Group subsystem initialized");
+    return HIVE_SUCCESS;
+}
+
+// Cleanup group subsystem
+void hive_group_cleanup(void) {
+    HIVE_CLEANUP_GUARD(s_group_table.initialized);
+
+    for (size_t i = 0; i < HIVE_MAX_GROUPS; i++) {
+        if (s_groups[i].active) {
+            free_members(&s_groups[i]);
+            s_groups[i].active = false;
+        }
+    }
+
+    s_group_table.initialized = false;
+    HIVE_LOG_DEBUG("Group subsystem cleaned up");
+}
+
+// Remove actor from all groups (called when actor dies)
+void hive_group_cleanup_actor(actor_id id) {
+    if (!s_group_table.initialized) {
+        return;
+    }
+
+    for (size_t i = 0; i < HIVE_MAX_GROUPS; i++) {
+        group_t *g = &s_groups[i];
+        if (!g->active) {
+            continue;
+        }
+
+        group_member *removed;
+        SLIST_FIND_REMOVE(g->members, entry->a->id == id, removed);
+        if (removed) {
+            hive_pool_free(&s_member_pool_mgr, removed);
+            g->count--;
+            HIVE_LOG_DEBUG("Actor %u left group %u (cleanup)", id, g->id);
+        }
+    }
+}
+
+hive_status hive_group_create(group_id *out) {
+    if (!out) {
+        return HIVE_ERROR(HIVE_ERR_INVALID, "NULL out pointer");
+    }
+
+    HIVE_REQUIRE_INIT(s_group_table.initialized, "Group subsystem");
+
+    for (size_t i = 0; i < HIVE_MAX_GROUPS; i++) {
+        group_t *g = &s_groups[i];
+        if (!g->active) {
+            g->id = s_group_table.next_id++;
+            if (s_group_table.next_id == GROUP_ID_INVALID) {
+                s_group_table.next_id = 1; // Skip 0 on wrap
+            }
+            g->members = NULL;
+            g->count = 0;
+            g->active = true;
+            *out = g->id;
+            HIVE_LOG_DEBUG("Created group %u", g->id);
+            return HIVE_SUCCESS;
+        }
+    }
+
+    return HIVE_ERROR(HIVE_ERR_NOMEM, "Group table full");
+}
+
+hive_status hive_group_destroy(group_id group) {
+    HIVE_REQUIRE_INIT(s_group_table.initialized, "Group subsystem");
+
+    group_t *g = find_group(group);
+    if (!g) {
+        return HIVE_ERROR(HIVE_ERR_INVALID, "Group not found");
+    }
+
+    free_members(g);
+    g->active = false;
+    HIVE_LOG_DEBUG("Destroyed group %u", group);
+    return HIVE_SUCCESS;
+}
+
+hive_status hive_group_join(group_id group) {
+    HIVE_REQUIRE_ACTOR_CONTEXT();
+    actor *current = hive_actor_current();
+
+    group_t *g = find_group(group);
+    if (!g) {
+        return HIVE_ERROR(HIVE_ERR_INVALID, "Group not found");
+    }
+
+    for (group_member *m = g->members; m; m = m->next) {
+        if (m->a == current) {
+            return HIVE_ERROR(HIVE_ERR_EXISTS, "Already a group member");
+        }
+    }
+
+    group_member *m = hive_pool_alloc(&s_member_pool_mgr);
+    if (!m) {
+        return HIVE_ERROR(HIVE_ERR_NOMEM, "Group member pool exhausted");
+    }
+
+    // Prepend: O(1), delivery order within a multicast is unspecified
+    m->a = current;
+    m->next = g->members;
+    g->members = m;
+    g->count++;
+    return HIVE_SUCCESS;
+}
+
+hive_status hive_group_leave(group_id group) {
+    HIVE_REQUIRE_ACTOR_CONTEXT();
+    actor *current = hive_actor_current();
+
+    group_t *g = find_group(group);
+    if (!g) {
+        return HIVE_ERROR(HIVE_ERR_INVALID, "Group not found");
+    }
+
+    group_member *removed;
+    SLIST_FIND_REMOVE(g->members, entry->a == current, removed);
+    if (!removed) {
+        return HIVE_ERROR(HIVE_ERR_INVALID, "Not a group member");
+    }
+
+    hive_pool_free(&s_member_pool_mgr, removed);
+    g->count--;
+    return HIVE_SUCCESS;
+}
+
+size_t hive_group_count(group_id group) {
+    if (!s_group_table.initialized) {
+        return 0;
+    }
+
+    group_t *g = find_group(group);
+    return g ? g->count : 0;
+}
+
+hive_status hive_ipc_multicast(group_id group, uint32_t tag, const void *data,
+                               size_t len) {
+    HIVE_REQUIRE_ACTOR_CONTEXT();
+    actor *current = hive_actor_current();
+
+    // Validate data pointer - NULL with len > 0 would cause memcpy crash
+    if (data == NULL && len > 0) {
+        return HIVE_ERROR(HIVE_ERR_INVALID, "NULL data with non-zero length");
+    }
+
+    group_t *g = find_group(group);
+    if (!g) {
+        return HIVE_ERROR(HIVE_ERR_INVALID, "Group not found");
+    }
+
+    if (g->count == 0) {
+        return HIVE_SUCCESS;
+    }
+
+    hive_multicast mc;
+    hive_status status = hive_ipc_multicast_begin(
+        &mc, g->count, current->id, HIVE_MSG_NOTIFY, tag, data, len);
+    if (HIVE_FAILED(status)) {
+        return status;
+    }
+    for (group_member *m = g->members; m; m = m->next) {
+        hive_ipc_multicast_deliver(&mc, m->a);
+    }
+    hive_ipc_multicast_end(&mc);
+
+    HIVE_LOG_TRACE("IPC: Multicast from %u to group %u (%zu members, tag=%u)",
+                   current->id, group, g->count, tag);
+    return HIVE_SUCCESS;
+}
@@ -19,6 +19,10 @@ hive_pool g_mailbox_pool_mgr; // Non-static so hive_link.c can access
 // Message data pool - fixed size entries (type defined in hive_internal.h)
 static message_data_entry s_message_pool[HIVE_MESSAGE_DATA_POOL_SIZE];
 static bool s_message_used[HIVE_MESSAGE_DATA_POOL_SIZE];
+// References per pool slot: > 1 when one payload is shared by several
+// mailbox entries (multicast) or borrowed bus reads; the entry returns to
+// the pool when the last reference is freed
+static uint32_t s_message_refs[HIVE_MESSAGE_DATA_POOL_SIZE];
 hive_pool g_message_pool_mgr; // Non-static so hive_link.c can access
 
 // Tag generator for request/reply correlation
@@ -66,17 +70,33 @@ hive_status hive_ipc_init(void) {
 // Internal Helpers
 // -----------------------------------------------------------------------------
 
-// Free message data back to the shared message pool
+// Reference count of the pool slot holding a data pointer handed out by
+// hive_msg_pool_alloc() (data is the first member of its entry)
+static uint32_t *msg_pool_refs(const void *data) {
+    return &s_message_refs[(const message_data_entry *)data - s_message_pool];
+}
+
+// Allocate message data from the shared message pool with one reference
+message_data_entry *hive_msg_pool_alloc(void) {
+    message_data_entry *msg_data = hive_pool_alloc(&g_message_pool_mgr);
+    if (msg_data) {
+        *msg_pool_refs(msg_data) = 1;
+    }
+    return msg_data;
+}
+
+// Drop a reference to message data in the shared message pool
 // This is the single point for freeing message pool entries (DRY principle)
 void hive_msg_pool_free(void *data) {
-    if (data) {
-        message_data_entry *msg_data =
-            (message_data_entry *)((char *)data -
-                                   offsetof(message_data_entry, data));
-        hive_pool_free(&g_message_pool_mgr, msg_data);
+    if (data && --*msg_pool_refs(data) == 0) {
+        hive_pool_free(&g_message_pool_mgr, data);
     }
 }
 
+void hive_msg_pool_ref(void *data) {
+    (*msg_pool_refs(data))++;
+}
+
 // Free a mailbox entry and its associated data buffer
 void hive_ipc_free_entry(mailbox_entry *entry) {
     if (!entry) {
@@ -86,35 +106,52 @@ void hive_ipc_free_entry(mailbox_entry *entry) {
     hive_pool_free(&g_mailbox_pool_mgr, entry);
 }
 
-// Check if a mailbox entry matches a single filter
-static bool entry_matches_filter(mailbox_entry *entry,
-                                 const hive_recv_filter *filter) {
-    // Check sender filter
-    if (filter->sender != HIVE_SENDER_ANY && entry->sender != filter->sender) {
-        return false;
+// Compile a receive filter: class and tag become one header mask/value pair
+void hive_filter_compile(const hive_recv_filter *filter,
+                         hive_compiled_filter *out) {
+    out->sender = filter->sender;
+    out->mask = 0;
+    out->value = 0;
+
+    if (filter->class != HIVE_MSG_ANY) {
+        out->mask = 0xF0000000;
+        out->value = (uint32_t)filter->class << 28;
+    }
+
+    if (filter->tag & HIVE_TAG_PREFIX_FLAG) {
+        // Bits above the lowest set bit (the wildcard marker) must match
+        uint32_t bits = filter->tag & HIVE_TAG_ANY;
+        uint32_t marker = bits & (~bits + 1);
+        uint32_t tag_mask = HIVE_TAG_ANY & ~(marker | (marker - 1));
+        out->mask |= tag_mask;
+        out->value |= bits & tag_mask;
+    } else if (filter->tag != HIVE_TAG_ANY) {
+        out->mask |= HIVE_TAG_ANY;
+        out->value |= filter->tag & HIVE_TAG_ANY;
     }
+}
 
-    // Need valid header to check class/tag
-    if (entry->len < HIVE_MSG_HEADER_SIZE) {
-        return false;
+// Wake actor if blocked and the new entry satisfies what it is waiting for
+static void mailbox_wake(actor *recipient, mailbox_entry *entry) {
+    if (recipient->state != ACTOR_STATE_WAITING) {
+        return;
     }
 
-    uint32_t header = *(uint32_t *)entry->data;
-    hive_msg_class msg_class;
-    uint32_t msg_tag;
-    decode_header(header, &msg_class, &msg_tag);
+    // Not in hive_select - wake on any message
+    bool should_wake = true;
 
-    // Check class filter
-    if (filter->class != HIVE_MSG_ANY && msg_class != filter->class) {
-        return false;
+    if (recipient->select_sources) {
+        // Only a matching message wakes it (its deadline wakes it directly)
+        should_wake = false;
+        for (size_t i = 0; !should_wake && i < recipient->wake_filter_count;
+             i++) {
+            should_wake = hive_filter_match(&recipient->wake_filters[i], entry);
+        }
     }
 
-    // Check tag filter
-    if (filter->tag != HIVE_TAG_ANY && msg_tag != filter->tag) {
-        return false;
+    if (should_wake) {
+        recipient->state = ACTOR_STATE_READY;
     }
-
-    return true;
 }
 
 // Add mailbox entry to actor's mailbox (doubly-linked list) and wake if blocked
@@ -130,58 +167,38 @@ void hive_mailbox_add_entry(actor *recipient, mailbox_entry *entry) {
     recipient->mailbox.tail = entry;
     recipient->mailbox.count++;
 
-    // Wake actor if blocked
-    if (recipient->state == ACTOR_STATE_WAITING) {
-        bool should_wake = false;
-
-        // Check hive_select sources first (if active)
-        if (recipient->select_sources) {
-            for (size_t i = 0; i < recipient->select_source_count; i++) {
-                if (recipient->select_sources[i].type == HIVE_SEL_IPC &&
-                    entry_matches_filter(entry,
-                                         &recipient->select_sources[i].ipc)) {
-                    should_wake = true;
-                    break;
-                }
-            }
-            // Also wake on TIMER messages (could be timeout timer)
-            if (!should_wake && entry->len >= HIVE_MSG_HEADER_SIZE) {
-                uint32_t header = *(uint32_t *)entry->data;
-                hive_msg_class msg_class = (hive_msg_class)(header >> 28);
-                if (msg_class == HIVE_MSG_TIMER) {
-                    should_wake = true;
-                }
-            }
-        } else if (recipient->recv_filters == NULL) {
-            // No filter active - wake on any message
-            should_wake = true;
-        } else {
-            // Filter active - check if message matches one of the filters
-            for (size_t i = 0; i < recipient->recv_filter_count; i++) {
-                if (entry_matches_filter(entry, &recipient->recv_filters[i])) {
-                    should_wake = true;
-                    break;
-                }
-            }
+    mailbox_wake(recipient, entry);
+}
 
-            // Also wake on TIMER messages (could be timeout timer)
-            if (!should_wake && entry->len >= HIVE_MSG_HEADER_SIZE) {
-                uint32_t header = *(uint32_t *)entry->data;
-                hive_msg_class msg_class = (hive_msg_class)(header >> 28);
-                if (msg_class == HIVE_MSG_TIMER) {
-                    should_wake = true;
-                }
-            }
-        }
+// Add mailbox entry behind any earlier urgent entries, ahead of the rest
+static void mailbox_add_urgent(actor *recipient, mailbox_entry *entry) {
+    mailbox *mbox = &recipient->mailbox;
+    mailbox_entry *after = mbox->urgent_tail;
 
-        if (should_wake) {
-            recipient->state = ACTOR_STATE_READY;
-        }
+    entry->prev = after;
+    entry->next = after ? after->next : mbox->head;
+    if (after) {
+        after->next = entry;
+    } else {
+        mbox->head = entry;
+    }
+    if (entry->next) {
+        entry->next->prev = entry;
+    } else {
+        mbox->tail = entry;
     }
+    mbox->urgent_tail = entry;
+    mbox->count++;
+
+    mailbox_wake(recipient, entry);
 }
 
 // Unlink entry from mailbox (supports unlinking from middle)
 static void mailbox_unlink(mailbox *mbox, mailbox_entry *entry) {
+    if (entry == mbox->urgent_tail) {
+        mbox->urgent_tail = entry->prev; // Urgent prefix is contiguous
+    }
+
     if (entry->prev) {
         entry->prev->next = entry->next;
     } else {
@@ -197,17 +214,24 @@ static void mailbox_unlink(mailbox *mbox, mailbox_entry *entry) {
     entry->next = NULL;
     entry->prev = NULL;
     mbox->count--;
+
+    // Let a periodic timer know its pending tick is gone
+    hive_msg_class class;
+    uint32_t tag;
+    decode_header(*(uint32_t *)entry->data, &class, &tag);
+    if (class == HIVE_MSG_TIMER) {
+        hive_timer_tick_dequeued(tag, entry);
+    }
 }
 
 // Scan mailbox for message matching any of the filters
 // Returns the matching entry and sets *matched_index to which filter matched
-static mailbox_entry *mailbox_find_match_any(mailbox *mbox,
-                                             const hive_recv_filter *filters,
-                                             size_t num_filters,
-                                             size_t *matched_index) {
+static mailbox_entry *mailbox_find_match_any(
+    mailbox *mbox, const hive_compiled_filter *filters, size_t num_filters,
+    size_t *matched_index) {
     for (mailbox_entry *entry = mbox->head; entry; entry = entry->next) {
         for (size_t i = 0; i < num_filters; i++) {
-            if (entry_matches_filter(entry, &filters[i])) {
+            if (hive_filter_match(&filters[i], entry)) {
                 if (matched_index) {
                     *matched_index = i;
                 }
@@ -228,45 +252,15 @@ mailbox_entry *hive_ipc_dequeue_head(actor *a) {
     return entry;
 }
 
-// Check for timeout message and handle it
-hive_status hive_mailbox_handle_timeout(actor *current, timer_id timeout_timer,
-                                        const char *operation) {
-    if (timeout_timer == TIMER_ID_INVALID) {
-        return HIVE_SUCCESS; // No timeout was set
-    }
-
-    // Check if first message is from OUR specific timeout timer
-    if (current->mailbox.head &&
-        current->mailbox.head->len >= HIVE_MSG_HEADER_SIZE) {
-        uint32_t header = *(uint32_t *)current->mailbox.head->data;
-        hive_msg_class msg_class;
-        uint32_t msg_tag;
-        decode_header(header, &msg_class, &msg_tag);
-
-        if (msg_class == HIVE_MSG_TIMER && msg_tag == timeout_timer) {
-            // This IS our timeout timer - dequeue, free, and return timeout
-            // error
-            mailbox_entry *entry = hive_ipc_dequeue_head(current);
-            hive_ipc_free_entry(entry);
-            return HIVE_ERROR(HIVE_ERR_TIMEOUT, operation);
-        }
-    }
-
-    // Not our timeout timer - another message arrived first
-    // Cancel our timeout timer and return success
-    hive_timer_cancel(timeout_timer);
-    return HIVE_SUCCESS;
-}
-
 // -----------------------------------------------------------------------------
 // Core Send/Receive
 // -----------------------------------------------------------------------------
 
-// Internal notify with explicit sender, class and tag (used by timer, link,
-// etc.)
-hive_status hive_ipc_notify_internal(actor_id to, actor_id sender,
-                                     hive_msg_class class, uint32_t tag,
-                                     const void *data, size_t len) {
+// Build a message and queue it in the normal or urgent lane
+// (*queued, if given, receives the mailbox entry)
+static hive_status ipc_send(actor_id to, actor_id sender, hive_msg_class class,
+                            uint32_t tag, const void *data, size_t len,
+                            bool urgent, mailbox_entry **queued) {
     actor *receiver = hive_actor_get(to);
     if (!receiver) {
         return HIVE_ERROR(HIVE_ERR_INVALID, "Invalid receiver actor ID");
@@ -286,7 +280,7 @@ hive_status hive_ipc_notify_internal(actor_id to, actor_id sender,
     }
 
     // Allocate message data from pool
-    message_data_entry *msg_data = hive_pool_alloc(&g_message_pool_mgr);
+    message_data_entry *msg_data = hive_msg_pool_alloc();
     if (!msg_data) {
         hive_pool_free(&g_mailbox_pool_mgr, entry);
         return HIVE_ERROR(HIVE_ERR_NOMEM, "Message data pool exhausted");
@@ -306,13 +300,35 @@ hive_status hive_ipc_notify_internal(actor_id to, actor_id sender,
     entry->prev = NULL;
 
     // Add to receiver's mailbox and wake if blocked
-    hive_mailbox_add_entry(receiver, entry);
+    if (urgent) {
+        mailbox_add_urgent(receiver, entry);
+    } else {
+        hive_mailbox_add_entry(receiver, entry);
+    }
 
-    HIVE_LOG_TRACE("IPC: Message sent from %u to %u (class=%d, tag=%u)", sender,
-                   to, class, tag);
+    HIVE_LOG_TRACE("IPC: Message sent from %u to %u (class=%d, tag=%u%s)",
+                   sender, to, class, tag, urgent ? ", urgent" : "");
+    if (queued) {
+        *queued = entry;
+    }
     return HIVE_SUCCESS;
 }
 
+// Internal notify with explicit sender, class and tag (used by timer, link,
+// etc.)
+hive_status hive_ipc_notify_internal(actor_id to, actor_id sender,
+                                     hive_msg_class class, uint32_t tag,
+                                     const void *data, size_t len) {
+    return ipc_send(to, sender, class, tag, data, len, false, NULL);
+}
+
+hive_status hive_ipc_notify_tick(actor_id owner, timer_id id,
+                                 const void *data, size_t len,
+                                 mailbox_entry **queued) {
+    return ipc_send(owner, owner, HIVE_MSG_TIMER, id, data, len, false,
+                    queued);
+}
+
 hive_status hive_ipc_notify(actor_id to, uint32_t tag, const void *data,
                             size_t len) {
     HIVE_REQUIRE_ACTOR_CONTEXT();
@@ -340,16 +356,145 @@ hive_status hive_ipc_notify_ex(actor_id to, hive_msg_class class, uint32_t tag,
     return hive_ipc_notify_internal(to, sender->id, class, tag, data, len);
 }
 
-// Maximum number of filters supported by hive_ipc_recv_matches
-#define HIVE_MAX_RECV_FILTERS 16
+hive_status hive_ipc_notify_urgent(actor_id to, uint32_t tag, const void *data,
+                                   size_t len) {
+    HIVE_REQUIRE_ACTOR_CONTEXT();
+    actor *sender = hive_actor_current();
+
+    // Validate data pointer - NULL with len > 0 would cause memcpy crash
+    if (data == NULL && len > 0) {
+        return HIVE_ERROR(HIVE_ERR_INVALID, "NULL data with non-zero length");
+    }
+
+    return ipc_send(to, sender->id, HIVE_MSG_NOTIFY, tag, data, len, true,
+                    NULL);
+}
+
+// -----------------------------------------------------------------------------
+// Multicast
+// -----------------------------------------------------------------------------
+
+hive_status hive_ipc_multicast_begin(hive_multicast *mc, size_t count,
+                                     actor_id sender, hive_msg_class class,
+                                     uint32_t tag, const void *data,
+                                     size_t len) {
+    size_t total_len = len + HIVE_MSG_HEADER_SIZE;
+    if (total_len > HIVE_MAX_MESSAGE_SIZE) {
+        return HIVE_ERROR(HIVE_ERR_INVALID,
+                          "Message exceeds HIVE_MAX_MESSAGE_SIZE");
+    }
+
+    message_data_entry *payload = hive_msg_pool_alloc();
+    if (!payload) {
+        return HIVE_ERROR(HIVE_ERR_NOMEM, "Message data pool exhausted");
+    }
+
+    // Reserve every mailbox entry before delivering any (all-or-nothing)
+    mailbox_entry *reserved = NULL;
+    for (size_t i = 0; i < count; i++) {
+        mailbox_entry *entry = hive_pool_alloc(&g_mailbox_pool_mgr);
+        if (!entry) {
+            while (reserved) {
+                mailbox_entry *next = reserved->next;
+                hive_pool_free(&g_mailbox_pool_mgr, reserved);
+                reserved = next;
+            }
+            hive_msg_pool_free(payload->data);
+            return HIVE_ERROR(HIVE_ERR_NOMEM, "Mailbox entry pool exhausted");
+        }
+        entry->next = reserved;
+        reserved = entry;
+    }
+
+    // Build message once: header + payload
+    uint32_t header = encode_header(class, tag);
+    memcpy(payload->data, &header, HIVE_MSG_HEADER_SIZE);
+    if (data && len > 0) {
+        memcpy(payload->data + HIVE_MSG_HEADER_SIZE, data, len);
+    }
+
+    mc->payload = payload;
+    mc->reserved = reserved;
+    mc->len = total_len;
+    mc->sender = sender;
+    return HIVE_SUCCESS;
+}
+
+void hive_ipc_multicast_deliver(hive_multicast *mc, actor *recipient) {
+    mailbox_entry *entry = mc->reserved;
+    if (!entry) {
+        return;
+    }
+    mc->reserved = entry->next;
+
+    hive_msg_pool_ref(mc->payload->data);
+    entry->sender = mc->sender;
+    entry->len = mc->len;
+    entry->data = mc->payload->data;
+    entry->next = NULL;
+    entry->prev = NULL;
+    hive_mailbox_add_entry(recipient, entry);
+}
+
+void hive_ipc_multicast_end(hive_multicast *mc) {
+    while (mc->reserved) {
+        mailbox_entry *next = mc->reserved->next;
+        hive_pool_free(&g_mailbox_pool_mgr, mc->reserved);
+        mc->reserved = next;
+    }
+    hive_msg_pool_free(mc->payload->data);
+    mc->payload = NULL;
+}
+
+hive_status hive_ipc_multicast_list(const actor_id *to, size_t count,
+                                    uint32_t tag, const void *data,
+                                    size_t len) {
+    HIVE_REQUIRE_ACTOR_CONTEXT();
+    actor *sender = hive_actor_current();
+
+    if (!to && count > 0) {
+        return HIVE_ERROR(HIVE_ERR_INVALID, "NULL recipient list");
+    }
+
+    // Validate data pointer - NULL with len > 0 would cause memcpy crash
+    if (data == NULL && len > 0) {
+        return HIVE_ERROR(HIVE_ERR_INVALID, "NULL data with non-zero length");
+    }
+
+    // Validate every recipient before reserving anything
+    for (size_t i = 0; i < count; i++) {
+        if (!hive_actor_get(to[i])) {
+            return HIVE_ERROR(HIVE_ERR_INVALID, "Invalid receiver actor ID");
+        }
+    }
+
+    hive_multicast mc;
+    hive_status status = hive_ipc_multicast_begin(
+        &mc, count, sender->id, HIVE_MSG_NOTIFY, tag, data, len);
+    if (HIVE_FAILED(status)) {
+        return status;
+    }
+    for (size_t i = 0; i < count; i++) {
+        hive_ipc_multicast_deliver(&mc, hive_actor_get(to[i]));
+    }
+    hive_ipc_multicast_end(&mc);
+
+    HIVE_LOG_TRACE("IPC: Multicast from %u to %zu actors (tag=%u)", sender->id,
+                   count, tag);
+    return HIVE_SUCCESS;
+}
 
 hive_status hive_ipc_recv(hive_message *msg, int32_t timeout_ms) {
-    // Wrapper around hive_select with wildcard IPC filter
+    return hive_ipc_recv_until(msg, hive_deadline_after_ms(timeout_ms));
+}
+
+hive_status hive_ipc_recv_until(hive_message *msg, uint64_t deadline_us) {
+    // Wrapper around hive_select_until with wildcard IPC filter
     hive_select_source source = {
         .type = HIVE_SEL_IPC,
         .ipc = {HIVE_SENDER_ANY, HIVE_MSG_ANY, HIVE_TAG_ANY}};
     hive_select_result result;
-    hive_status s = hive_select(&source, 1, &result, timeout_ms);
+    hive_status s = hive_select_until(&source, 1, &result, deadline_us);
     if (HIVE_SUCCEEDED(s)) {
         *msg = result.ipc;
     }
@@ -359,11 +504,18 @@ hive_status hive_ipc_recv(hive_message *msg, int32_t timeout_ms) {
 hive_status hive_ipc_recv_match(actor_id from, hive_msg_class class,
                                 uint32_t tag, hive_message *msg,
                                 int32_t timeout_ms) {
-    // Wrapper around hive_select with single IPC filter
+    return hive_ipc_recv_match_until(from, class, tag, msg,
+                                     hive_deadline_after_ms(timeout_ms));
+}
+
+hive_status hive_ipc_recv_match_until(actor_id from, hive_msg_class class,
+                                      uint32_t tag, hive_message *msg,
+                                      uint64_t deadline_us) {
+    // Wrapper around hive_select_until with single IPC filter
     hive_select_source source = {.type = HIVE_SEL_IPC,
                                  .ipc = {from, class, tag}};
     hive_select_result result;
-    hive_status s = hive_select(&source, 1, &result, timeout_ms);
+    hive_status s = hive_select_until(&source, 1, &result, deadline_us);
     if (HIVE_SUCCEEDED(s)) {
         *msg = result.ipc;
     }
@@ -373,6 +525,15 @@ hive_status hive_ipc_recv_match(actor_id from, hive_msg_class class,
 hive_status hive_ipc_recv_matches(const hive_recv_filter *filters,
                                   size_t num_filters, hive_message *msg,
                                   int32_t timeout_ms, size_t *matched_index) {
+    return hive_ipc_recv_matches_until(filters, num_filters, msg,
+                                       hive_deadline_after_ms(timeout_ms),
+                                       matched_index);
+}
+
+hive_status hive_ipc_recv_matches_until(const hive_recv_filter *filters,
+                                        size_t num_filters, hive_message *msg,
+                                        uint64_t deadline_us,
+                                        size_t *matched_index) {
     HIVE_REQUIRE_ACTOR_CONTEXT();
 
     if (!filters || num_filters == 0) {
@@ -391,7 +552,8 @@ hive_status hive_ipc_recv_matches(const hive_recv_filter *filters,
     }
 
     hive_select_result result;
-    hive_status s = hive_select(sources, num_filters, &result, timeout_ms);
+    hive_status s =
+        hive_select_until(sources, num_filters, &result, deadline_us);
     if (HIVE_SUCCEEDED(s)) {
         *msg = result.ipc;
         if (matched_index) {
@@ -435,9 +597,10 @@ hive_status hive_ipc_request(actor_id to, const void *request, size_t req_len,
         return status;
     }
 
-    // Wait for REPLY or EXIT from target
+    // Wait for REPLY or EXIT from target. The reply may come from another
+    // actor if the request was forwarded; the generated tag is unique.
     hive_recv_filter filters[] = {
-        {to, HIVE_MSG_REPLY, call_tag},
+        {HIVE_SENDER_ANY, HIVE_MSG_REPLY, call_tag},
         {to, HIVE_MSG_EXIT, HIVE_TAG_ANY},
     };
 
@@ -485,6 +648,123 @@ hive_status hive_ipc_reply(const hive_message *request, const void *data,
                                     HIVE_MSG_REPLY, request->tag, data, len);
 }
 
+hive_status hive_ipc_defer_reply(const hive_message *request,
+                                 hive_reply_handle *out) {
+    if (!request || !out) {
+        return HIVE_ERROR(HIVE_ERR_INVALID, "NULL request or out pointer");
+    }
+
+    if (request->class != HIVE_MSG_REQUEST) {
+        return HIVE_ERROR(HIVE_ERR_INVALID,
+                          "Can only defer HIVE_MSG_REQUEST messages");
+    }
+
+    out->to = request->sender;
+    out->tag = request->tag;
+    return HIVE_SUCCESS;
+}
+
+hive_status hive_ipc_reply_deferred(const hive_reply_handle *handle,
+                                    const void *data, size_t len) {
+    HIVE_REQUIRE_ACTOR_CONTEXT();
+    actor *current = hive_actor_current();
+
+    if (!handle || handle->to == ACTOR_ID_INVALID) {
+        return HIVE_ERROR(HIVE_ERR_INVALID, "Invalid reply handle");
+    }
+
+    // Validate data pointer
+    if (data == NULL && len > 0) {
+        return HIVE_ERROR(HIVE_ERR_INVALID, "NULL data with non-zero length");
+    }
+
+    return hive_ipc_notify_internal(handle->to, current->id, HIVE_MSG_REPLY,
+                                    handle->tag, data, len);
+}
+
+// -----------------------------------------------------------------------------
+// Message Retention
+// -----------------------------------------------------------------------------
+
+// Check if a received entry backs the given message (payload follows header)
+static bool entry_backs_message(const mailbox_entry *entry,
+                                const hive_message *msg) {
+    return (const uint8_t *)entry->data + HIVE_MSG_HEADER_SIZE == msg->data;
+}
+
+// Find the actor's retained entry for a message (NULL if not retained)
+// O(1): the message's handle names the entry's mailbox pool slot
+static mailbox_entry *find_retained(actor *a, const hive_message *msg) {
+    if (msg->handle == 0 || msg->handle > HIVE_MAILBOX_ENTRY_POOL_SIZE) {
+        return NULL;
+    }
+    mailbox_entry *entry = &s_mailbox_pool[msg->handle - 1];
+    if (entry->retained_by != a->id || !entry_backs_message(entry, msg)) {
+        return NULL;
+    }
+    return entry;
+}
+
+// Remove an entry from the retained list
+static void unlink_retained(actor *a, mailbox_entry *entry) {
+    entry->retained_by = ACTOR_ID_INVALID;
+    if (entry->prev) {
+        entry->prev->next = entry->next;
+    } else {
+        a->retained = entry->next;
+    }
+    if (entry->next) {
+        entry->next->prev = entry->prev;
+    }
+}
+
+hive_status hive_msg_retain(const hive_message *msg) {
+    HIVE_REQUIRE_ACTOR_CONTEXT();
+    actor *current = hive_actor_current();
+
+    if (!msg) {
+        return HIVE_ERROR(HIVE_ERR_INVALID, "NULL message");
+    }
+
+    mailbox_entry *entry = current->active_msg;
+    if (!entry || !entry_backs_message(entry, msg)) {
+        if (find_retained(current, msg)) {
+            return HIVE_SUCCESS; // Already retained
+        }
+        return HIVE_ERROR(HIVE_ERR_INVALID,
+                          "Message is not the most recently received");
+    }
+
+    // Detach from active slot so the next receive does not free it
+    current->active_msg = NULL;
+    entry->retained_by = current->id;
+    entry->prev = NULL;
+    entry->next = current->retained;
+    if (current->retained) {
+        current->retained->prev = entry;
+    }
+    current->retained = entry;
+    return HIVE_SUCCESS;
+}
+
+hive_status hive_msg_release(const hive_message *msg) {
+    HIVE_REQUIRE_ACTOR_CONTEXT();
+    actor *current = hive_actor_current();
+
+    if (!msg) {
+        return HIVE_ERROR(HIVE_ERR_INVALID, "NULL message");
+    }
+
+    mailbox_entry *entry = find_retained(current, msg);
+    if (!entry) {
+        return HIVE_ERROR(HIVE_ERR_INVALID, "Message is not retained");
+    }
+
+    unlink_retained(current, entry);
+    hive_ipc_free_entry(entry);
+    return HIVE_SUCCESS;
+}
+
 // -----------------------------------------------------------------------------
 // Message Inspection
 // -----------------------------------------------------------------------------
@@ -497,6 +777,14 @@ bool hive_msg_is_timer(const hive_message *msg) {
     return msg->class == HIVE_MSG_TIMER;
 }
 
+uint32_t hive_timer_missed(const hive_message *msg) {
+    uint32_t missed = 0;
+    if (hive_msg_is_timer(msg) && msg->len >= sizeof(missed)) {
+        memcpy(&missed, msg->data, sizeof(missed));
+    }
+    return missed;
+}
+
 // -----------------------------------------------------------------------------
 // Query Functions
 // -----------------------------------------------------------------------------
@@ -535,20 +823,69 @@ void hive_ipc_mailbox_clear(mailbox *mbox) {
     }
     mbox->head = NULL;
     mbox->tail = NULL;
+    mbox->urgent_tail = NULL;
     mbox->count = 0;
 }
 
+// -----------------------------------------------------------------------------
+// Forwarding
+// -----------------------------------------------------------------------------
+
+hive_status hive_ipc_forward(const hive_message *msg, actor_id to) {
+    HIVE_REQUIRE_ACTOR_CONTEXT();
+    actor *current = hive_actor_current();
+
+    if (!msg) {
+        return HIVE_ERROR(HIVE_ERR_INVALID, "NULL message");
+    }
+
+    actor *receiver = hive_actor_get(to);
+    if (!receiver) {
+        return HIVE_ERROR(HIVE_ERR_INVALID, "Invalid receiver actor ID");
+    }
+
+    // Detach the entry from the caller (active slot or retained list)
+    mailbox_entry *entry = current->active_msg;
+    if (entry && entry_backs_message(entry, msg)) {
+        current->active_msg = NULL;
+    } else {
+        entry = find_retained(current, msg);
+        if (!entry) {
+            return HIVE_ERROR(HIVE_ERR_INVALID,
+                              "Message is not received or retained");
+        }
+        unlink_retained(current, entry);
+    }
+
+    // Sender and header travel with the entry unchanged
+    hive_mailbox_add_entry(receiver, entry);
+
+    HIVE_LOG_TRACE("IPC: Message from %u forwarded by %u to %u", entry->sender,
+                   current->id, to);
+    return HIVE_SUCCESS;
+}
+
 // Free an active message entry (called during actor cleanup)
 void hive_ipc_free_active_msg(mailbox_entry *entry) {
     hive_ipc_free_entry(entry);
 }
 
+// Free all retained message entries (called during actor cleanup)
+void hive_ipc_free_retained(mailbox_entry *head) {
+    while (head) {
+        mailbox_entry *next = head->next;
+        head->retained_by = ACTOR_ID_INVALID;
+        hive_ipc_free_entry(head);
+        head = next;
+    }
+}
+
 // -----------------------------------------------------------------------------
 // hive_select helpers
 // -----------------------------------------------------------------------------
 
 // Scan mailbox for message matching any of the filters (non-blocking)
-mailbox_entry *hive_ipc_scan_mailbox(const hive_recv_filter *filters,
+mailbox_entry *hive_ipc_scan_mailbox(const hive_compiled_filter *filters,
                                      size_t num_filters,
                                      size_t *matched_index) {
     actor *current = hive_actor_current();
@@ -586,6 +923,7 @@ void hive_ipc_consume_entry(mailbox_entry *entry, hive_message *msg) {
     msg->tag = msg_tag;
     msg->len = entry->len - HIVE_MSG_HEADER_SIZE;
     msg->data = (const uint8_t *)entry->data + HIVE_MSG_HEADER_SIZE;
+    msg->handle = (uint32_t)(entry - s_mailbox_pool) + 1;
 
     // Store entry as active message for later cleanup
     current->active_msg = entry;
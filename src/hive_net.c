@@ -167,32 +167,22 @@ void hive_net_cleanup(void) {
 
 // Helper: Try non-blocking I/O, add to epoll if would block
 static hive_status try_or_epoll(int fd, uint32_t epoll_events, int operation,
-                                void *buf, size_t len, int32_t timeout_ms) {
+                                void *buf, size_t len, uint64_t deadline_us) {
     HIVE_REQUIRE_ACTOR_CONTEXT();
     actor *current = hive_actor_current();
 
-    // Non-blocking mode: timeout=0 means "poll once and return immediately"
-    if (timeout_ms == 0) {
+    // Non-blocking mode: poll once and return immediately
+    if (deadline_us == HIVE_DEADLINE_NOW) {
         return HIVE_ERROR(HIVE_ERR_WOULDBLOCK, "Operation would block");
     }
-
-    // Create timeout timer if needed (timeout > 0)
-    // Note: timeout < 0 means "wait forever" (no timer)
-    timer_id timeout_timer = TIMER_ID_INVALID;
-    if (timeout_ms > 0) {
-        hive_status status =
-            hive_timer_after((uint32_t)timeout_ms * 1000, &timeout_timer);
-        if (HIVE_FAILED(status)) {
-            return status; // Timer pool exhausted
-        }
+    bool timed = deadline_us != HIVE_DEADLINE_NONE;
+    if (timed && hive_get_time() >= deadline_us) {
+        return HIVE_ERROR(HIVE_ERR_TIMEOUT, "Network I/O deadline passed");
     }
 
     // Allocate io_source from pool
     io_source *source = hive_pool_alloc(&s_io_source_pool_mgr);
     if (!source) {
-        if (timeout_timer != TIMER_ID_INVALID) {
-            hive_timer_cancel(timeout_timer);
-        }
         return HIVE_ERROR(HIVE_ERR_NOMEM, "io_source pool exhausted");
     }
 
@@ -212,24 +202,35 @@ static hive_status try_or_epoll(int fd, uint32_t epoll_events, int operation,
 
     if (epoll_ctl(epoll_fd, EPOLL_CTL_ADD, fd, &ev) < 0) {
         hive_pool_free(&s_io_source_pool_mgr, source);
-        if (timeout_timer != TIMER_ID_INVALID) {
-            hive_timer_cancel(timeout_timer);
-        }
         return HIVE_ERROR(HIVE_ERR_IO, "epoll_ctl failed");
     }
 
-    // Block actor until I/O ready
-    current->state = ACTOR_STATE_WAITING;
-    hive_yield();
+    // The deadline lives in the actor's own slot: no timer to allocate
+    if (timed) {
+        hive_timer_deadline_arm(current, deadline_us);
+    }
 
-    // When we resume, check for timeout
-    hive_status timeout_status = hive_mailbox_handle_timeout(
-        current, timeout_timer, "Network I/O operation timed out");
-    if (HIVE_FAILED(timeout_status)) {
+    // Block until the event handler stores a result. Messages arriving
+    // meanwhile wake the actor too; they stay queued and it blocks again.
+    current->io_status = HIVE_ERROR(HIVE_ERR_WOULDBLOCK, "I/O pending");
+    bool pending;
+    for (;;) {
+        current->state = ACTOR_STATE_WAITING;
+        hive_yield();
+        pending = current->io_status.code == HIVE_ERR_WOULDBLOCK;
+        if (!pending || (timed && !hive_timer_deadline_pending(current))) {
+            break;
+        }
+    }
+    if (timed) {
+        hive_timer_deadline_cancel(current);
+    }
+
+    if (pending) {
         // Timeout occurred - cleanup epoll registration
         epoll_ctl(epoll_fd, EPOLL_CTL_DEL, fd, NULL);
         hive_pool_free(&s_io_source_pool_mgr, source);
-        return timeout_status;
+        return HIVE_ERROR(HIVE_ERR_TIMEOUT, "Network I/O operation timed out");
     }
 
     // Return the result stored by the event handler
@@ -275,6 +276,12 @@ hive_status hive_net_listen(uint16_t port, int *fd_out) {
 
 hive_status hive_net_accept(int listen_fd, int *conn_fd_out,
                             int32_t timeout_ms) {
+    return hive_net_accept_until(listen_fd, conn_fd_out,
+                                 hive_deadline_after_ms(timeout_ms));
+}
+
+hive_status hive_net_accept_until(int listen_fd, int *conn_fd_out,
+                                  uint64_t deadline_us) {
     if (!conn_fd_out) {
         return HIVE_ERROR(HIVE_ERR_INVALID, "NULL conn_fd_out pointer");
     }
@@ -304,7 +311,7 @@ hive_status hive_net_accept(int listen_fd, int *conn_fd_out,
 
     // Would block - register interest in epoll and yield
     hive_status status =
-        try_or_epoll(listen_fd, EPOLLIN, NET_OP_ACCEPT, NULL, 0, timeout_ms);
+        try_or_epoll(listen_fd, EPOLLIN, NET_OP_ACCEPT, NULL, 0, deadline_us);
     if (HIVE_FAILED(status)) {
         return status;
     }
@@ -316,6 +323,12 @@ hive_status hive_net_accept(int listen_fd, int *conn_fd_out,
 
 hive_status hive_net_connect(const char *ip, uint16_t port, int *fd_out,
                              int32_t timeout_ms) {
+    return hive_net_connect_until(ip, port, fd_out,
+                                  hive_deadline_after_ms(timeout_ms));
+}
+
+hive_status hive_net_connect_until(const char *ip, uint16_t port, int *fd_out,
+                                   uint64_t deadline_us) {
     if (!ip || !fd_out) {
         return HIVE_ERROR(HIVE_ERR_INVALID, "NULL ip or fd_out pointer");
     }
@@ -352,7 +365,7 @@ hive_status hive_net_connect(const char *ip, uint16_t port, int *fd_out,
 
         // Connection in progress - add to epoll and wait for writable
         hive_status status =
-            try_or_epoll(fd, EPOLLOUT, NET_OP_CONNECT, NULL, 0, timeout_ms);
+            try_or_epoll(fd, EPOLLOUT, NET_OP_CONNECT, NULL, 0, deadline_us);
         if (HIVE_FAILED(status)) {
             close(fd);
             return status;
@@ -378,6 +391,12 @@ hive_status hive_net_close(int fd) {
 
 hive_status hive_net_recv(int fd, void *buf, size_t len, size_t *received,
                           int32_t timeout_ms) {
+    return hive_net_recv_until(fd, buf, len, received,
+                               hive_deadline_after_ms(timeout_ms));
+}
+
+hive_status hive_net_recv_until(int fd, void *buf, size_t len,
+                                size_t *received, uint64_t deadline_us) {
     if (!buf || !received) {
         return HIVE_ERROR(HIVE_ERR_INVALID, "NULL buffer or received pointer");
     }
@@ -402,7 +421,7 @@ hive_status hive_net_recv(int fd, void *buf, size_t len, size_t *received,
 
     // Would block - register interest in epoll and yield
     hive_status status =
-        try_or_epoll(fd, EPOLLIN, NET_OP_RECV, buf, len, timeout_ms);
+        try_or_epoll(fd, EPOLLIN, NET_OP_RECV, buf, len, deadline_us);
     if (HIVE_FAILED(status)) {
         return status;
     }
@@ -414,6 +433,12 @@ hive_status hive_net_recv(int fd, void *buf, size_t len, size_t *received,
 
 hive_status hive_net_send(int fd, const void *buf, size_t len, size_t *sent,
                           int32_t timeout_ms) {
+    return hive_net_send_until(fd, buf, len, sent,
+                               hive_deadline_after_ms(timeout_ms));
+}
+
+hive_status hive_net_send_until(int fd, const void *buf, size_t len,
+                                size_t *sent, uint64_t deadline_us) {
     if (!buf || !sent) {
         return HIVE_ERROR(HIVE_ERR_INVALID, "NULL buffer or sent pointer");
     }
@@ -438,7 +463,7 @@ hive_status hive_net_send(int fd, const void *buf, size_t len, size_t *sent,
 
     // Would block - register interest in epoll and yield
     hive_status status =
-        try_or_epoll(fd, EPOLLOUT, NET_OP_SEND, (void *)buf, len, timeout_ms);
+        try_or_epoll(fd, EPOLLOUT, NET_OP_SEND, (void *)buf, len, deadline_us);
     if (HIVE_FAILED(status)) {
         return status;
     }
@@ -8,6 +8,8 @@
 #include <stdlib.h>
 #include <string.h>
 
+extern actor_table *hive_actor_get_table(void);
+
 // =============================================================================
 // Name Registry
 // =============================================================================
@@ -50,10 +52,20 @@ hive_status hive_init(void) {
         return status;
     }
 
+    // Initialize process group subsystem
+    status = hive_group_init();
+    if (HIVE_FAILED(status)) {
+        hive_link_cleanup();
+        hive_scheduler_cleanup();
+        hive_actor_cleanup();
+        return status;
+    }
+
 #if HIVE_ENABLE_FILE
     // Initialize file I/O subsystem
     status = hive_file_init();
     if (HIVE_FAILED(status)) {
+        hive_group_cleanup();
         hive_link_cleanup();
         hive_scheduler_cleanup();
         hive_actor_cleanup();
@@ -68,6 +80,7 @@ hive_status hive_init(void) {
 #if HIVE_ENABLE_FILE
         hive_file_cleanup();
 #endif
+        hive_group_cleanup();
         hive_link_cleanup();
         hive_scheduler_cleanup();
         hive_actor_cleanup();
@@ -84,6 +97,7 @@ hive_status hive_init(void) {
 #if HIVE_ENABLE_FILE
         hive_file_cleanup();
 #endif
+        hive_group_cleanup();
         hive_link_cleanup();
         hive_scheduler_cleanup();
         hive_actor_cleanup();
@@ -100,6 +114,7 @@ hive_status hive_init(void) {
 #if HIVE_ENABLE_FILE
         hive_file_cleanup();
 #endif
+        hive_group_cleanup();
         hive_link_cleanup();
         hive_scheduler_cleanup();
         hive_actor_cleanup();
@@ -121,6 +136,54 @@ void hive_advance_time(uint64_t delta_us) {
     hive_timer_advance_time(delta_us);
 }
 
+static struct {
+    uint64_t now_us;
+    bool valid;
+} s_coarse = {0};
+
+uint64_t hive_get_time_coarse(void) {
+    if (!s_coarse.valid) {
+        s_coarse.now_us = hive_get_time();
+        s_coarse.valid = true;
+    }
+    return s_coarse.now_us;
+}
+
+void hive_time_coarse_invalidate(void) {
+    s_coarse.valid = false;
+}
+
+hive_status hive_run_until_idle_sim(uint64_t until_us) {
+    actor_table *table = hive_actor_get_table();
+
+    // Enter simulation mode without moving time
+    hive_timer_advance_time(0);
+
+    for (;;) {
+        hive_status status = hive_scheduler_run_until_blocked();
+        if (HIVE_FAILED(status)) {
+            return status;
+        }
+        if (hive_scheduler_should_stop() || table->num_actors == 0) {
+            return HIVE_SUCCESS;
+        }
+
+        // Everyone is blocked: nothing happens until the next deadline
+        uint64_t next;
+        if (!hive_timer_next_deadline(&next)) {
+            return HIVE_SUCCESS; // Idle - no timer will ever wake anyone
+        }
+        uint64_t now = hive_get_time();
+        if (next > until_us) {
+            if (until_us > now) {
+                hive_timer_advance_time(until_us - now);
+            }
+            return HIVE_SUCCESS;
+        }
+        hive_timer_advance_time(next > now ? next - now : 0);
+    }
+}
+
 void hive_shutdown(void) {
     hive_scheduler_shutdown();
 }
@@ -134,6 +197,7 @@ void hive_cleanup(void) {
 #if HIVE_ENABLE_FILE
     hive_file_cleanup();
 #endif
+    hive_group_cleanup();
     hive_link_cleanup();
     hive_scheduler_cleanup();
     hive_actor_cleanup();
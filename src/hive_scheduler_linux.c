@@ -21,6 +21,7 @@ static struct {
     size_t last_run_idx[HIVE_PRIORITY_COUNT]; // Last run actor index for each
                                               // priority
     int epoll_fd;                             // Event loop file descriptor
+    uint32_t runs_since_poll; // Actor runs since the last epoll poll
 } s_scheduler = {0};
 
 // Dispatch pending epoll events (timeout_ms: -1=block, 0=poll, >0=wait)
@@ -48,6 +49,7 @@ static void run_single_actor(actor *a) {
     HIVE_LOG_TRACE("Scheduler: Running actor %u (prio=%d)", a->id, a->priority);
     a->state = ACTOR_STATE_RUNNING;
     hive_actor_set_current(a);
+    hive_time_coarse_invalidate(); // New iteration: coarse "now" is stale
 
     // Context switch to actor
     hive_context_switch(&s_scheduler.scheduler_ctx, &a->ctx);
@@ -138,7 +140,19 @@ void hive_scheduler_run(void) {
 
         if (next) {
             run_single_actor(next);
+            // Busy actors must not starve timers and I/O: poll periodically
+            if (++s_scheduler.runs_since_poll >= HIVE_EPOLL_POLL_INTERVAL) {
+                s_scheduler.runs_since_poll = 0;
+                dispatch_epoll_events(0);
+            }
         } else {
+            s_scheduler.runs_since_poll = 0;
+
+            // A deadline inside the spin window is busy-polled, not slept on
+            if (hive_timer_spin()) {
+                continue;
+            }
+
             // No runnable actors - wait for I/O events with short timeout
             // (IPC/bus/link don't use epoll, they directly set actor state)
             dispatch_epoll_events(HIVE_EPOLL_POLL_TIMEOUT_MS);
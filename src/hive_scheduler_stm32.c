@@ -17,6 +17,7 @@ extern actor_table *hive_actor_get_table(void);
 
 // External timer functions (from hive_timer_stm32.c)
 extern void hive_timer_process_pending(void);
+extern void hive_timer_idle(void);
 
 // Scheduler state
 static struct {
@@ -36,8 +37,9 @@ static void dispatch_events(void) {
 // Wait for events using WFI (Wait For Interrupt)
 static void wait_for_events(void) {
     // On ARM Cortex-M, WFI sleeps until an interrupt occurs
-    // This is the low-power idle state
-    __asm__ volatile("wfi");
+    // This is the low-power idle state. With a tickless idle hook the timer
+    // backend also stops the periodic tick until the next timer event.
+    hive_timer_idle();
 }
 
 // Run a single actor: context switch, check stack, handle exit/yield
@@ -45,6 +47,7 @@ static void run_single_actor(actor *a) {
     HIVE_LOG_TRACE("Scheduler: Running actor %u (prio=%d)", a->id, a->priority);
     a->state = ACTOR_STATE_RUNNING;
     hive_actor_set_current(a);
+    hive_time_coarse_invalidate(); // New iteration: coarse "now" is stale
 
     // Context switch to actor
     hive_context_switch(&s_scheduler.scheduler_ctx, &a->ctx);
@@ -8,35 +8,32 @@
 #include "hive_log.h"
 #include <string.h>
 
-// Static buffer for bus data (single-threaded, one actor at a time)
-static uint8_t s_bus_data_buffer[HIVE_MAX_MESSAGE_SIZE];
-static size_t s_bus_data_len = 0;
-
 // -----------------------------------------------------------------------------
 // Internal helpers
 // -----------------------------------------------------------------------------
 
 // Scan sources for ready data (non-blocking)
+// 'compiled' holds the IPC sources' filters in source order
 // Returns true if data found, populates result
 // Priority: strict array order (first ready source wins)
 static bool scan_sources(const hive_select_source *sources, size_t num_sources,
+                         const hive_compiled_filter *compiled,
                          hive_select_result *result) {
+    size_t ipc_index = 0;
     for (size_t i = 0; i < num_sources; i++) {
         if (sources[i].type == HIVE_SEL_BUS) {
             if (hive_bus_has_data(sources[i].bus)) {
-                // Read bus data into static buffer
+                // Borrow the entry in place (no copy); the lease lasts until
+                // this actor's next read of the bus
+                const void *data = NULL;
                 size_t actual_len = 0;
                 hive_status status =
-                    hive_bus_read(sources[i].bus, s_bus_data_buffer,
-                                  sizeof(s_bus_data_buffer), &actual_len);
-                // Accept OK or TRUNCATED (data was read, possibly truncated)
-                if (HIVE_SUCCEEDED(status) ||
-                    status.code == HIVE_ERR_TRUNCATED) {
+                    hive_bus_read_ref(sources[i].bus, &data, &actual_len);
+                if (HIVE_SUCCEEDED(status)) {
                     result->index = i;
                     result->type = HIVE_SEL_BUS;
-                    result->bus.data = s_bus_data_buffer;
+                    result->bus.data = data;
                     result->bus.len = actual_len;
-                    s_bus_data_len = actual_len;
                     HIVE_LOG_TRACE("select: bus source %zu ready, %zu bytes", i,
                                    actual_len);
                     return true;
@@ -45,7 +42,7 @@ static bool scan_sources(const hive_select_source *sources, size_t num_sources,
         } else if (sources[i].type == HIVE_SEL_IPC) {
             size_t matched_idx = 0;
             mailbox_entry *entry =
-                hive_ipc_scan_mailbox(&sources[i].ipc, 1, &matched_idx);
+                hive_ipc_scan_mailbox(&compiled[ipc_index++], 1, &matched_idx);
             if (entry) {
                 // Found matching IPC message
                 hive_ipc_consume_entry(entry, &result->ipc);
@@ -80,12 +77,53 @@ static void set_bus_blocked_flags(const hive_select_source *sources,
     }
 }
 
+// Arm the actor's wait deadline slot for the select deadline, or earlier
+// if a rate-limited bus source holds back data until its interval ends
+// (no publish wakes the actor for that data)
+static void arm_wake(actor *a, const hive_select_source *sources,
+                     size_t num_sources, uint64_t deadline_us) {
+    uint64_t at = deadline_us;
+    for (size_t i = 0; i < num_sources; i++) {
+        uint64_t held;
+        if (sources[i].type == HIVE_SEL_BUS &&
+            hive_bus_held_until(sources[i].bus, &held) && held < at) {
+            at = held;
+        }
+    }
+    a->select_wake_us = HIVE_DEADLINE_NONE;
+    hive_select_wake_at(a, at);
+}
+
 // -----------------------------------------------------------------------------
 // hive_select implementation
 // -----------------------------------------------------------------------------
 
+void hive_select_wake_at(actor *a, uint64_t at_us) {
+    if (at_us < a->select_wake_us) {
+        a->select_wake_us = at_us;
+        hive_timer_deadline_arm(a, at_us);
+    }
+}
+
+uint64_t hive_deadline_after_ms(int32_t timeout_ms) {
+    if (timeout_ms < 0) {
+        return HIVE_DEADLINE_NONE;
+    }
+    if (timeout_ms == 0) {
+        return HIVE_DEADLINE_NOW;
+    }
+    return hive_get_time() + (uint64_t)timeout_ms * 1000;
+}
+
 hive_status hive_select(const hive_select_source *sources, size_t num_sources,
                         hive_select_result *result, int32_t timeout_ms) {
+    return hive_select_until(sources, num_sources, result,
+                             hive_deadline_after_ms(timeout_ms));
+}
+
+hive_status hive_select_until(const hive_select_source *sources,
+                              size_t num_sources, hive_select_result *result,
+                              uint64_t deadline_us) {
     HIVE_REQUIRE_ACTOR_CONTEXT();
     actor *current = hive_actor_current();
 
@@ -100,13 +138,20 @@ hive_status hive_select(const hive_select_source *sources, size_t num_sources,
         return HIVE_ERROR(HIVE_ERR_INVALID, "NULL result pointer");
     }
 
-    // Validate bus sources are subscribed
+    // Validate bus sources are subscribed and compile IPC filters once
+    hive_compiled_filter compiled[HIVE_MAX_RECV_FILTERS];
+    size_t num_ipc = 0;
     for (size_t i = 0; i < num_sources; i++) {
         if (sources[i].type == HIVE_SEL_BUS) {
             if (!hive_bus_is_subscribed(sources[i].bus)) {
                 return HIVE_ERROR(HIVE_ERR_INVALID,
                                   "Bus source not subscribed");
             }
+        } else if (sources[i].type == HIVE_SEL_IPC) {
+            if (num_ipc == HIVE_MAX_RECV_FILTERS) {
+                return HIVE_ERROR(HIVE_ERR_INVALID, "Too many IPC sources");
+            }
+            hive_filter_compile(&sources[i].ipc, &compiled[num_ipc++]);
         }
     }
 
@@ -114,58 +159,64 @@ hive_status hive_select(const hive_select_source *sources, size_t num_sources,
                    num_sources);
 
     // Non-blocking scan
-    if (scan_sources(sources, num_sources, result)) {
+    if (scan_sources(sources, num_sources, compiled, result)) {
         return HIVE_SUCCESS;
     }
 
     // Nothing ready
-    if (timeout_ms == 0) {
+    if (deadline_us == HIVE_DEADLINE_NOW) {
         return HIVE_ERROR(HIVE_ERR_WOULDBLOCK, "No data available");
     }
+    bool timed = deadline_us != HIVE_DEADLINE_NONE;
+    if (timed && hive_get_time() >= deadline_us) {
+        return HIVE_ERROR(HIVE_ERR_TIMEOUT, "Select deadline passed");
+    }
 
     // Set up for blocking
     current->select_sources = sources;
     current->select_source_count = num_sources;
+    current->wake_filters = compiled;
+    current->wake_filter_count = num_ipc;
 
     // Mark bus subscribers as blocked
     set_bus_blocked_flags(sources, num_sources);
 
-    // Create timeout timer if needed
-    timer_id timeout_timer = TIMER_ID_INVALID;
-    if (timeout_ms > 0) {
-        hive_status status =
-            hive_timer_after((uint32_t)timeout_ms * 1000, &timeout_timer);
-        if (HIVE_FAILED(status)) {
-            current->select_sources = NULL;
-            current->select_source_count = 0;
-            clear_bus_blocked_flags(sources, num_sources);
-            return status;
+    // The deadline lives in the actor's own slot: no timer to allocate
+    arm_wake(current, sources, num_sources, deadline_us);
+
+    // Block until a source has data or the deadline fires. A wakeup whose
+    // data was taken first (another reader of a bus) just blocks again
+    // against the same deadline. An earlier wake for held-back bus data
+    // that finds nothing re-arms for the next one.
+    bool found;
+    for (;;) {
+        current->state = ACTOR_STATE_WAITING;
+        hive_scheduler_yield();
+        found = scan_sources(sources, num_sources, compiled, result);
+        if (found) {
+            break;
+        }
+        if (current->select_wake_us == HIVE_DEADLINE_NONE ||
+            hive_timer_deadline_pending(current)) {
+            continue; // Woken by something else
         }
+        if (current->select_wake_us == deadline_us) {
+            break; // The select deadline itself fired
+        }
+        arm_wake(current, sources, num_sources, deadline_us);
     }
 
-    // Block and wait
-    current->state = ACTOR_STATE_WAITING;
-    hive_scheduler_yield();
-
     // Woken up - clear state
+    hive_timer_deadline_cancel(current);
+    current->select_wake_us = HIVE_DEADLINE_NONE;
     current->select_sources = NULL;
     current->select_source_count = 0;
+    current->wake_filters = NULL;
+    current->wake_filter_count = 0;
     clear_bus_blocked_flags(sources, num_sources);
 
-    // Check for timeout
-    if (timeout_timer != TIMER_ID_INVALID) {
-        hive_status timeout_status = hive_mailbox_handle_timeout(
-            current, timeout_timer, "Select timeout");
-        if (HIVE_FAILED(timeout_status)) {
-            return timeout_status;
-        }
+    if (!found) {
+        return HIVE_ERROR(HIVE_ERR_TIMEOUT, "Select timeout");
     }
-
-    // Re-scan for data
-    if (scan_sources(sources, num_sources, result)) {
-        return HIVE_SUCCESS;
-    }
-
-    // Spurious wakeup - no matching data found
-    return HIVE_ERROR(HIVE_ERR_WOULDBLOCK, "No data available after wakeup");
+    return HIVE_SUCCESS;
 }
@@ -580,8 +580,8 @@ hive_status hive_supervisor_stop(actor_id supervisor) {
         return HIVE_ERROR(HIVE_ERR_INVALID, "invalid supervisor ID");
     }
 
-    // Send stop message
-    return hive_ipc_notify(supervisor, SUP_TAG_STOP, NULL, 0);
+    // Urgent lane: stop is seen ahead of any queued child exits
+    return hive_ipc_notify_urgent(supervisor, SUP_TAG_STOP, NULL, 0);
 }
 
 const char *hive_restart_strategy_str(hive_restart_strategy strategy) {
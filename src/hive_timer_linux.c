@@ -11,84 +11,339 @@
 #include <string.h>
 #include <unistd.h>
 #include <errno.h>
-#include <time.h>
 #include <sys/timerfd.h>
 #include <sys/epoll.h>
 
+// All timers share one timerfd armed (absolute) to the earliest deadline.
+// Pending timers live in a binary min-heap keyed on expiry; ids map straight
+// to pool slots, so create and cancel are O(log n) with no syscalls unless
+// the earliest deadline moves earlier. The same heap drives simulation mode,
+// where hive_advance_time() replaces the timerfd. With a spin threshold the
+// timerfd is armed that much early and the idle scheduler busy-polls the
+// clock for the final stretch (hive_timer_spin). Blocked actors' wait
+// deadlines (hive_select_until and friends) share the heap through one
+// static entry per actor slot, so they never draw on the timer pool.
+
 // Active timer entry
 typedef struct timer_entry {
-    timer_id id;
+    timer_id id;  // Kept after free: the slot's next id bumps its generation
+    uint32_t seq; // Creation order, breaks ties between equal deadlines
     actor_id owner;
-    int fd; // timerfd (only used in real-time mode)
     bool periodic;
-    uint64_t expiry_us;   // Expiry time in microseconds (simulation mode)
-    uint64_t interval_us; // Interval for periodic timers (simulation mode)
-    struct timer_entry *next;
-    io_source source; // For epoll registration
+    bool deadline;        // Actor wait deadline: wakes the owner, no message
+    uint64_t expiry_us;   // Absolute expiry (monotonic or simulation time)
+    uint64_t interval_us; // Interval for periodic timers
+    uint64_t slack_us;    // May fire up to this late (batches wakeups)
+    uint64_t missed;      // Periods lost to undelivered ticks, reported next
+    mailbox_entry *pending; // Periodic tick still queued in the owner's mailbox
+    size_t heap_index;    // Position in s_timer.heap (HEAP_NONE if not queued)
+    hive_timer_stats stats;
 } timer_entry;
 
+// Retry delay for a one-shot tick that could not be delivered (pools full)
+#define TIMER_RETRY_US 1000
+
+#define HEAP_NONE SIZE_MAX
+
+extern actor_table *hive_actor_get_table(void);
+
 // Static pool for timer entries
 static timer_entry s_timer_pool[HIVE_TIMER_ENTRY_POOL_SIZE];
 static bool s_timer_used[HIVE_TIMER_ENTRY_POOL_SIZE];
 static hive_pool s_timer_pool_mgr;
 
+// Wait deadline per actor slot (indexed like the actor table)
+static timer_entry s_deadlines[HIVE_MAX_ACTORS];
+
 // Timer subsystem state
 static struct {
     bool initialized;
-    timer_entry *timers; // Active timers list
-    timer_id next_id;
+    timer_entry *heap[HIVE_TIMER_ENTRY_POOL_SIZE +
+                      HIVE_MAX_ACTORS]; // Min-heap on expiry_us
+    size_t count;                       // Timers and deadlines in heap
+    uint32_t next_seq;
+    int fd;               // Shared timerfd (-1 in simulation mode)
+    uint64_t armed_us;    // Deadline the timerfd is armed for (0 = disarmed)
+    uint64_t spin_us;     // Busy-poll this long before deadlines (0 = off)
+    io_source source;     // For epoll registration
     bool sim_mode;        // Simulation time mode (enabled by hive_advance_time)
     uint64_t sim_time_us; // Current simulation time in microseconds
 } s_timer = {0};
 
-// Helper: Close timer fd and remove from epoll (only in real-time mode)
-static void timer_close_fd(timer_entry *entry) {
-    if (entry->fd >= 0) {
-        int epoll_fd = hive_scheduler_get_epoll_fd();
-        epoll_ctl(epoll_fd, EPOLL_CTL_DEL, entry->fd, NULL);
-        close(entry->fd);
-        entry->fd = -1;
+static uint32_t clamp_u32(uint64_t value) {
+    return value > UINT32_MAX ? UINT32_MAX : (uint32_t)value;
+}
+
+// -----------------------------------------------------------------------------
+// Min-heap (ties broken by creation order)
+// -----------------------------------------------------------------------------
+
+static bool heap_before(const timer_entry *a, const timer_entry *b) {
+    if (a->expiry_us != b->expiry_us) {
+        return a->expiry_us < b->expiry_us;
+    }
+    return (int32_t)(a->seq - b->seq) < 0;
+}
+
+static void heap_set(size_t i, timer_entry *entry) {
+    s_timer.heap[i] = entry;
+    entry->heap_index = i;
+}
+
+static void heap_sift_up(size_t i) {
+    timer_entry *entry = s_timer.heap[i];
+    while (i > 0) {
+        size_t parent = (i - 1) / 2;
+        if (!heap_before(entry, s_timer.heap[parent])) {
+            break;
+        }
+        heap_set(i, s_timer.heap[parent]);
+        i = parent;
+    }
+    heap_set(i, entry);
+}
+
+static void heap_sift_down(size_t i) {
+    timer_entry *entry = s_timer.heap[i];
+    for (;;) {
+        size_t child = 2 * i + 1;
+        if (child >= s_timer.count) {
+            break;
+        }
+        if (child + 1 < s_timer.count &&
+            heap_before(s_timer.heap[child + 1], s_timer.heap[child])) {
+            child++;
+        }
+        if (!heap_before(s_timer.heap[child], entry)) {
+            break;
+        }
+        heap_set(i, s_timer.heap[child]);
+        i = child;
+    }
+    heap_set(i, entry);
+}
+
+static void heap_push(timer_entry *entry) {
+    heap_set(s_timer.count++, entry);
+    heap_sift_up(entry->heap_index);
+}
+
+static void heap_remove(timer_entry *entry) {
+    size_t i = entry->heap_index;
+    timer_entry *last = s_timer.heap[--s_timer.count];
+    if (last != entry) {
+        heap_set(i, last);
+        heap_sift_up(i);
+        heap_sift_down(last->heap_index);
+    }
+}
+
+// -----------------------------------------------------------------------------
+// timerfd arming
+// -----------------------------------------------------------------------------
+
+// Arm the shared timerfd for 'deadline_us' (absolute, hive_clock_us())
+static void timerfd_arm(uint64_t deadline_us) {
+    if (s_timer.fd < 0 || deadline_us == s_timer.armed_us) {
+        return;
+    }
+
+    // A zero it_value disarms, so 0 is only ever used to disarm. The
+    // kernel compares against CLOCK_MONOTONIC, not the (TSC) runtime clock.
+    uint64_t kernel_us = hive_clock_to_monotonic(deadline_us);
+    struct itimerspec its = {0};
+    its.it_value.tv_sec = kernel_us / HIVE_USEC_PER_SEC;
+    its.it_value.tv_nsec = (kernel_us % HIVE_USEC_PER_SEC) * 1000;
+    if (timerfd_settime(s_timer.fd, TFD_TIMER_ABSTIME, &its, NULL) < 0) {
+        HIVE_LOG_ERROR("timerfd_settime failed: errno=%d", errno);
+        return;
     }
+    s_timer.armed_us = deadline_us;
+}
+
+// Latest time a timer may fire (its slack window ends), never 0 (disarm)
+static uint64_t timer_latest(const timer_entry *entry) {
+    uint64_t latest = entry->expiry_us + entry->slack_us;
+    return latest ? latest : 1;
 }
 
-// Handle timer event from scheduler (called when timerfd fires)
+// When to wake for a deadline: spin_us early, so the idle scheduler can
+// busy-poll the rest. Never 0 (disarm)
+static uint64_t timer_wake_at(uint64_t latest) {
+    return latest > s_timer.spin_us ? latest - s_timer.spin_us : 1;
+}
+
+// Minimum timer_latest() over the subtree at 'i'. Subtrees whose root
+// expires at or after 'best' cannot improve on it and are pruned, so only
+// timers inside the current batching window are visited.
+static uint64_t heap_min_latest(size_t i, uint64_t best) {
+    if (i >= s_timer.count || s_timer.heap[i]->expiry_us >= best) {
+        return best;
+    }
+    uint64_t latest = timer_latest(s_timer.heap[i]);
+    if (latest < best) {
+        best = latest;
+    }
+    best = heap_min_latest(2 * i + 1, best);
+    return heap_min_latest(2 * i + 2, best);
+}
+
+// Re-arm after the armed deadline fired: wake when the first slack window
+// closes, then every timer already due fires in the same batch.
+// Cancelling never re-arms: a stale early wakeup just lands here.
+// Inside the spin window the deadline itself is armed, as a backstop for
+// when actors stay runnable and the scheduler never spins.
+static void timerfd_rearm(void) {
+    s_timer.armed_us = 0;
+    if (s_timer.count == 0) {
+        return;
+    }
+    uint64_t latest = heap_min_latest(0, UINT64_MAX);
+    uint64_t wake = timer_wake_at(latest);
+    timerfd_arm(wake > hive_clock_us() ? wake : latest);
+}
+
+// -----------------------------------------------------------------------------
+// Firing
+// -----------------------------------------------------------------------------
+
+// Fire every timer due at 'now_us' (each at most once per call unless
+// 'catch_up' is set, which replays every missed period - simulation mode)
+static void fire_due_timers(uint64_t now_us, bool catch_up) {
+    while (s_timer.count > 0 && s_timer.heap[0]->expiry_us <= now_us) {
+        timer_entry *entry = s_timer.heap[0];
+
+        if (entry->deadline) {
+            // Wake the owner if it is still blocked on this deadline
+            heap_remove(entry);
+            entry->heap_index = HEAP_NONE;
+            actor *a = &hive_actor_get_table()->actors[entry - s_deadlines];
+            if (a->id == entry->owner && a->state == ACTOR_STATE_WAITING) {
+                a->state = ACTOR_STATE_READY;
+            }
+            continue;
+        }
+
+        // Get the actor
+        actor *a = hive_actor_get(entry->owner);
+        if (!a) {
+            // Actor is dead - cleanup timer
+            heap_remove(entry);
+            hive_pool_free(&s_timer_pool_mgr, entry);
+            continue;
+        }
+
+        // A periodic timer that fell behind delivers one tick for its
+        // latest due period and reports the ones in between as missed
+        // (catch_up replays them instead). Due times stay on the
+        // start + k * interval grid, so periodic timers never drift.
+        uint64_t step = entry->interval_us ? entry->interval_us : 1;
+        uint64_t due = entry->expiry_us;
+        uint64_t missed = entry->missed;
+        if (entry->periodic && !catch_up && now_us - due >= step) {
+            uint64_t behind = (now_us - due) / step;
+            due += behind * step;
+            missed += behind;
+        }
+
+        if (entry->periodic && entry->pending) {
+            // Previous tick not received yet: fold this expiration into it
+            // rather than queueing another (at most one tick per timer)
+            hive_timer_tick_add_missed(entry->pending, missed + 1);
+            entry->stats.missed += missed + 1;
+            entry->missed = 0;
+            entry->expiry_us = due + step;
+            heap_sift_down(0);
+            continue;
+        }
+
+        // Send timer tick message to actor
+        // Use HIVE_MSG_TIMER class with timer_id as tag, sender is the owning
+        // actor. Periodic ticks carry the missed period count as payload
+        HIVE_LOG_DEBUG("Timer %u fired for actor %u (now=%lu, expiry=%lu)",
+                       entry->id, entry->owner, (unsigned long)now_us,
+                       (unsigned long)due);
+        uint32_t payload = clamp_u32(missed);
+        hive_status status = hive_ipc_notify_tick(
+            entry->owner, entry->id, entry->periodic ? &payload : NULL,
+            entry->periodic ? sizeof(payload) : 0,
+            entry->periodic ? &entry->pending : NULL);
+        bool delivered = HIVE_SUCCEEDED(status);
+        if (delivered) {
+            uint32_t late = clamp_u32(now_us - due);
+            entry->stats.ticks++;
+            entry->stats.missed += missed;
+            entry->stats.total_late_us += late;
+            entry->stats.last_late_us = late;
+            if (late > entry->stats.max_late_us) {
+                entry->stats.max_late_us = late;
+            }
+            entry->missed = 0;
+        } else {
+            HIVE_LOG_ERROR("Failed to send timer tick: %s", status.msg);
+            entry->missed = missed + 1; // This period is lost too
+        }
+
+        if (!entry->periodic && delivered) {
+            heap_remove(entry);
+            hive_pool_free(&s_timer_pool_mgr, entry);
+            continue;
+        }
+
+        // Reschedule: periodic timers keep their phase; an undelivered
+        // one-shot is retried shortly
+        if (!entry->periodic) {
+            entry->expiry_us = now_us + TIMER_RETRY_US;
+        } else {
+            entry->expiry_us = due + step;
+            if (!delivered && entry->expiry_us <= now_us) {
+                // Don't retry a failed delivery in the same call
+                uint64_t behind = (now_us - entry->expiry_us) / step + 1;
+                entry->expiry_us += behind * step;
+                entry->missed += behind;
+            }
+        }
+        heap_sift_down(0);
+    }
+}
+
+// Handle timer event from scheduler (called when the shared timerfd fires)
 void hive_timer_handle_event(io_source *source) {
-    timer_entry *entry = source->data.timer;
+    (void)source;
 
     // Read timerfd to acknowledge
     uint64_t expirations;
-    ssize_t n = read(entry->fd, &expirations, sizeof(expirations));
+    ssize_t n = read(s_timer.fd, &expirations, sizeof(expirations));
     (void)n; // Suppress unused result warning
 
-    // Get the actor
-    actor *a = hive_actor_get(entry->owner);
-    if (!a) {
-        // Actor is dead - cleanup timer
-        timer_close_fd(entry);
-        SLIST_REMOVE(s_timer.timers, entry);
-        hive_pool_free(&s_timer_pool_mgr, entry);
-        return;
-    }
+    fire_due_timers(hive_clock_us(), false);
+    timerfd_rearm();
+}
 
-    // Send timer tick message to actor
-    // Use HIVE_MSG_TIMER class with timer_id as tag, sender is the owning actor
-    // No payload needed - timer_id is encoded in the tag
-    hive_status status = hive_ipc_notify_internal(
-        entry->owner, entry->owner, HIVE_MSG_TIMER, entry->id, NULL, 0);
-    if (HIVE_FAILED(status)) {
-        HIVE_LOG_ERROR("Failed to send timer tick: %s", status.msg);
-        // Don't cleanup timer - try again next tick
-        return;
+bool hive_timer_spin(void) {
+    if (!s_timer.initialized || s_timer.sim_mode || s_timer.spin_us == 0 ||
+        s_timer.count == 0) {
+        return false;
     }
 
-    // If one-shot, cleanup
-    if (!entry->periodic) {
-        timer_close_fd(entry);
-        SLIST_REMOVE(s_timer.timers, entry);
-        hive_pool_free(&s_timer_pool_mgr, entry);
+    uint64_t deadline = heap_min_latest(0, UINT64_MAX);
+    uint64_t now = hive_clock_us();
+    if (deadline > now + s_timer.spin_us) {
+        return false; // Not yet: sleep in epoll until the spin window opens
+    }
+    while (now < deadline) {
+        now = hive_clock_us();
     }
+
+    fire_due_timers(now, false);
+    timerfd_rearm();
+    return true;
 }
 
+// -----------------------------------------------------------------------------
+// Init / cleanup
+// -----------------------------------------------------------------------------
+
 // Initialize timer subsystem
 hive_status hive_timer_init(void) {
     HIVE_INIT_GUARD(s_timer.initialized);
@@ -98,32 +353,92 @@ hive_status hive_timer_init(void) {
                    sizeof(timer_entry), HIVE_TIMER_ENTRY_POOL_SIZE);
 
     // Initialize timer state
-    s_timer.timers = NULL;
-    s_timer.next_id = 1;
+    s_timer.count = 0;
+    s_timer.next_seq = 0;
+    s_timer.armed_us = 0;
+    s_timer.spin_us = HIVE_TIMER_SPIN_US;
+    for (size_t i = 0; i < HIVE_MAX_ACTORS; i++) {
+        s_deadlines[i].deadline = true;
+        s_deadlines[i].heap_index = HEAP_NONE;
+    }
+
+    // One timerfd for all timers, registered with the scheduler's epoll
+    s_timer.fd = timerfd_create(CLOCK_MONOTONIC, TFD_NONBLOCK | TFD_CLOEXEC);
+    if (s_timer.fd < 0) {
+        return HIVE_ERROR(HIVE_ERR_IO, "timerfd_create failed");
+    }
+
+    s_timer.source.type = IO_SOURCE_TIMER;
+    s_timer.source.data.timer = NULL;
+
+    struct epoll_event ev;
+    ev.events = EPOLLIN;
+    ev.data.ptr = &s_timer.source;
+    if (epoll_ctl(hive_scheduler_get_epoll_fd(), EPOLL_CTL_ADD, s_timer.fd,
+                  &ev) < 0) {
+        close(s_timer.fd);
+        s_timer.fd = -1;
+        return HIVE_ERROR(HIVE_ERR_IO, "epoll_ctl failed");
+    }
 
     s_timer.initialized = true;
     return HIVE_SUCCESS;
 }
 
+// Close the shared timerfd and remove it from epoll
+static void timer_close_fd(void) {
+    if (s_timer.fd >= 0) {
+        epoll_ctl(hive_scheduler_get_epoll_fd(), EPOLL_CTL_DEL, s_timer.fd,
+                  NULL);
+        close(s_timer.fd);
+        s_timer.fd = -1;
+        s_timer.armed_us = 0;
+    }
+}
+
 // Cleanup timer subsystem
 void hive_timer_cleanup(void) {
     HIVE_CLEANUP_GUARD(s_timer.initialized);
 
     // Clean up all active timers
-    timer_entry *entry = s_timer.timers;
-    while (entry) {
-        timer_entry *next = entry->next;
-        timer_close_fd(entry);
-        hive_pool_free(&s_timer_pool_mgr, entry);
-        entry = next;
+    for (size_t i = 0; i < s_timer.count; i++) {
+        if (!s_timer.heap[i]->deadline) {
+            hive_pool_free(&s_timer_pool_mgr, s_timer.heap[i]);
+        }
     }
-    s_timer.timers = NULL;
+    s_timer.count = 0;
+    timer_close_fd();
 
     s_timer.initialized = false;
 }
 
-// Create a timer (one-shot or periodic)
-static hive_status create_timer(uint32_t interval_us, bool periodic,
+// -----------------------------------------------------------------------------
+// Public API
+// -----------------------------------------------------------------------------
+
+// O(1) lookup: the id names the slot, the generation rejects stale ids
+static timer_entry *find_timer(timer_id id) {
+    size_t slot = hive_timer_id_slot(id);
+    if (slot >= HIVE_TIMER_ENTRY_POOL_SIZE || !s_timer_used[slot] ||
+        s_timer_pool[slot].id != id) {
+        return NULL;
+    }
+    return &s_timer_pool[slot];
+}
+
+// Only touch the timerfd if 'entry' must fire before the armed deadline
+// (a slack timer due earlier just joins that wakeup)
+static void timer_schedule(const timer_entry *entry) {
+    uint64_t wake = timer_wake_at(timer_latest(entry));
+    if (!s_timer.sim_mode &&
+        (s_timer.armed_us == 0 || wake < s_timer.armed_us)) {
+        timerfd_arm(wake);
+    }
+}
+
+// Create a timer (one-shot or periodic) first due at 'expiry_us'
+static hive_status create_timer(uint64_t expiry_us, uint32_t interval_us,
+                                uint32_t slack_us, bool periodic,
                                 timer_id *out) {
     if (!out) {
         return HIVE_ERROR(HIVE_ERR_INVALID, "NULL out pointer");
@@ -140,121 +455,159 @@ static hive_status create_timer(uint32_t interval_us, bool periodic,
         return HIVE_ERROR(HIVE_ERR_NOMEM, "Timer entry pool exhausted");
     }
 
-    // Initialize common fields
-    entry->id = s_timer.next_id++;
+    entry->id = hive_timer_next_id((size_t)(entry - s_timer_pool), entry->id);
+    entry->seq = s_timer.next_seq++;
     entry->owner = current->id;
     entry->periodic = periodic;
-    entry->interval_us =
-        interval_us; // Always store for potential sim mode conversion
-    entry->next = s_timer.timers;
+    entry->deadline = false;
+    entry->interval_us = interval_us;
+    entry->expiry_us = expiry_us;
+    entry->slack_us = slack_us;
+    entry->missed = 0;
+    entry->pending = NULL;
+    memset(&entry->stats, 0, sizeof(entry->stats));
+    heap_push(entry);
+    timer_schedule(entry);
+
+    HIVE_LOG_DEBUG("Timer %u created (expiry=%lu)", entry->id,
+                   (unsigned long)entry->expiry_us);
+    *out = entry->id;
+    return HIVE_SUCCESS;
+}
 
-    if (s_timer.sim_mode) {
-        // Simulation mode: store expiry time, no timerfd
-        entry->fd = -1;
-        entry->expiry_us = s_timer.sim_time_us + interval_us;
-        HIVE_LOG_DEBUG(
-            "Timer %u created in sim mode (expiry=%lu, sim_time=%lu)",
-            entry->id, (unsigned long)entry->expiry_us,
-            (unsigned long)s_timer.sim_time_us);
-    } else {
-        // Real-time mode: use timerfd
-        int tfd = timerfd_create(CLOCK_MONOTONIC, TFD_NONBLOCK);
-        if (tfd < 0) {
-            hive_pool_free(&s_timer_pool_mgr, entry);
-            return HIVE_ERROR(HIVE_ERR_IO, "timerfd_create failed");
-        }
+hive_status hive_timer_after(uint32_t delay_us, timer_id *out) {
+    return create_timer(hive_get_time() + delay_us, delay_us, 0, false, out);
+}
 
-        // Set timer
-        // Note: timerfd treats (0, 0) as "disarm timer", so we use minimum 1ns
-        // for zero delay
-        struct itimerspec its;
-        if (interval_us == 0) {
-            its.it_value.tv_sec = 0;
-            its.it_value.tv_nsec = 1; // Minimum 1 nanosecond to avoid disarming
-        } else {
-            its.it_value.tv_sec = interval_us / HIVE_USEC_PER_SEC;
-            its.it_value.tv_nsec = (interval_us % HIVE_USEC_PER_SEC) * 1000;
-        }
+hive_status hive_timer_after_slack(uint32_t delay_us, uint32_t slack_us,
+                                   timer_id *out) {
+    return create_timer(hive_get_time() + delay_us, delay_us, slack_us, false,
+                        out);
+}
 
-        if (periodic) {
-            // Periodic - set interval
-            its.it_interval.tv_sec = its.it_value.tv_sec;
-            its.it_interval.tv_nsec = its.it_value.tv_nsec;
-        } else {
-            // One-shot - no interval
-            its.it_interval.tv_sec = 0;
-            its.it_interval.tv_nsec = 0;
-        }
+hive_status hive_timer_every(uint32_t interval_us, timer_id *out) {
+    if (interval_us == 0) {
+        return HIVE_ERROR(HIVE_ERR_INVALID, "Zero interval");
+    }
+    return create_timer(hive_get_time() + interval_us, interval_us, 0, true,
+                        out);
+}
 
-        if (timerfd_settime(tfd, 0, &its, NULL) < 0) {
-            close(tfd);
-            hive_pool_free(&s_timer_pool_mgr, entry);
-            return HIVE_ERROR(HIVE_ERR_IO, "timerfd_settime failed");
-        }
+hive_status hive_timer_every_abs(uint64_t start_us, uint32_t interval_us,
+                                 timer_id *out) {
+    if (interval_us == 0) {
+        return HIVE_ERROR(HIVE_ERR_INVALID, "Zero interval");
+    }
+    return create_timer(start_us, interval_us, 0, true, out);
+}
 
-        entry->fd = tfd;
-        entry->interval_us = interval_us;
-        entry->expiry_us = 0; // Not used in real-time mode
+bool hive_timer_next_deadline(uint64_t *deadline_us) {
+    if (!s_timer.initialized || s_timer.count == 0) {
+        return false;
+    }
+    *deadline_us = s_timer.heap[0]->expiry_us;
+    return true;
+}
 
-        // Setup io_source for epoll
-        entry->source.type = IO_SOURCE_TIMER;
-        entry->source.data.timer = entry;
+void hive_timer_tick_dequeued(timer_id id, const mailbox_entry *entry) {
+    timer_entry *timer = find_timer(id);
+    if (timer && timer->pending == entry) {
+        timer->pending = NULL;
+    }
+}
 
-        // Add to scheduler's epoll
-        int epoll_fd = hive_scheduler_get_epoll_fd();
-        struct epoll_event ev;
-        ev.events = EPOLLIN;
-        ev.data.ptr = &entry->source;
+hive_status hive_timer_get_stats(timer_id id, hive_timer_stats *out) {
+    if (!out) {
+        return HIVE_ERROR(HIVE_ERR_INVALID, "NULL out pointer");
+    }
 
-        if (epoll_ctl(epoll_fd, EPOLL_CTL_ADD, tfd, &ev) < 0) {
-            close(tfd);
-            hive_pool_free(&s_timer_pool_mgr, entry);
-            return HIVE_ERROR(HIVE_ERR_IO, "epoll_ctl failed");
-        }
+    HIVE_REQUIRE_INIT(s_timer.initialized, "Timer");
+
+    timer_entry *entry = find_timer(id);
+    if (!entry) {
+        return HIVE_ERROR(HIVE_ERR_INVALID, "Timer not found");
     }
 
-    s_timer.timers = entry;
-    *out = entry->id;
+    *out = entry->stats;
     return HIVE_SUCCESS;
 }
 
-hive_status hive_timer_after(uint32_t delay_us, timer_id *out) {
-    return create_timer(delay_us, false, out);
-}
+hive_status hive_timer_set_spin(uint32_t spin_us) {
+    HIVE_REQUIRE_INIT(s_timer.initialized, "Timer");
 
-hive_status hive_timer_every(uint32_t interval_us, timer_id *out) {
-    return create_timer(interval_us, true, out);
+    s_timer.spin_us = spin_us;
+    if (!s_timer.sim_mode) {
+        timerfd_rearm();
+    }
+    return HIVE_SUCCESS;
 }
 
 hive_status hive_timer_cancel(timer_id id) {
     HIVE_REQUIRE_INIT(s_timer.initialized, "Timer");
 
-    // Find and remove timer from list
-    timer_entry *found = NULL;
-    SLIST_FIND_REMOVE(s_timer.timers, entry->id == id, found);
+    timer_entry *entry = find_timer(id);
+    if (!entry) {
+        return HIVE_ERROR(HIVE_ERR_INVALID, "Timer not found");
+    }
+
+    // No re-arm: an early wakeup for this deadline is harmless
+    heap_remove(entry);
+    hive_pool_free(&s_timer_pool_mgr, entry);
+    return HIVE_SUCCESS;
+}
 
-    if (found) {
-        timer_close_fd(found);
-        hive_pool_free(&s_timer_pool_mgr, found);
-        return HIVE_SUCCESS;
+// -----------------------------------------------------------------------------
+// Actor wait deadlines
+// -----------------------------------------------------------------------------
+
+static timer_entry *deadline_of(const actor *a) {
+    return &s_deadlines[a - hive_actor_get_table()->actors];
+}
+
+void hive_timer_deadline_arm(actor *a, uint64_t deadline_us) {
+    timer_entry *entry = deadline_of(a);
+    entry->seq = s_timer.next_seq++;
+    entry->owner = a->id;
+    entry->expiry_us = deadline_us;
+    entry->slack_us = 0;
+    if (entry->heap_index == HEAP_NONE) {
+        heap_push(entry);
+    } else {
+        heap_sift_up(entry->heap_index);
+        heap_sift_down(entry->heap_index);
     }
+    timer_schedule(entry);
+}
 
-    return HIVE_ERROR(HIVE_ERR_INVALID, "Timer not found");
+bool hive_timer_deadline_pending(const actor *a) {
+    return deadline_of(a)->heap_index != HEAP_NONE;
 }
 
-hive_status hive_sleep(uint32_t delay_us) {
-    // Create one-shot timer
-    timer_id timer;
-    hive_status s = hive_timer_after(delay_us, &timer);
-    if (HIVE_FAILED(s)) {
-        return s;
+void hive_timer_deadline_cancel(actor *a) {
+    timer_entry *entry = deadline_of(a);
+    if (entry->heap_index != HEAP_NONE) {
+        // No re-arm, as for hive_timer_cancel
+        heap_remove(entry);
+        entry->heap_index = HEAP_NONE;
     }
+}
 
-    // Wait specifically for THIS timer message
-    // Other messages remain in mailbox (selective receive)
-    hive_message msg;
-    return hive_ipc_recv_match(HIVE_SENDER_ANY, HIVE_MSG_TIMER, timer, &msg,
-                               -1);
+hive_status hive_sleep(uint32_t delay_us) {
+    return hive_sleep_until(hive_get_time() + delay_us);
+}
+
+hive_status hive_sleep_until(uint64_t deadline_us) {
+    HIVE_REQUIRE_INIT(s_timer.initialized, "Timer");
+    HIVE_REQUIRE_ACTOR_CONTEXT();
+    actor *current = hive_actor_current();
+
+    // Messages arriving meanwhile wake the actor; they stay queued
+    hive_timer_deadline_arm(current, deadline_us);
+    while (hive_timer_deadline_pending(current)) {
+        current->state = ACTOR_STATE_WAITING;
+        hive_scheduler_yield();
+    }
+    return HIVE_SUCCESS;
 }
 
 // Advance simulation time and fire due timers
@@ -269,89 +622,28 @@ void hive_timer_advance_time(uint64_t delta_us) {
         s_timer.sim_mode = true;
         HIVE_LOG_INFO("Simulation time mode enabled");
 
-        // Convert any existing timerfd-based timers to simulation mode
-        for (timer_entry *entry = s_timer.timers; entry; entry = entry->next) {
-            if (entry->fd >= 0) {
-                // Close timerfd and unregister from epoll
-                timer_close_fd(entry);
-                // Set expiry based on interval (fires on first advance after
-                // interval)
-                entry->expiry_us = entry->interval_us;
+        // Real-time timers restart their interval on the simulated clock,
+        // wait deadlines keep the time they had left
+        timer_close_fd();
+        uint64_t now = hive_clock_us();
+        for (size_t i = 0; i < s_timer.count; i++) {
+            timer_entry *entry = s_timer.heap[i];
+            uint64_t remaining = entry->interval_us;
+            if (entry->deadline) {
+                remaining =
+                    entry->expiry_us > now ? entry->expiry_us - now : 0;
             }
+            entry->expiry_us = s_timer.sim_time_us + remaining;
+        }
+        for (size_t i = s_timer.count / 2; i-- > 0;) {
+            heap_sift_down(i);
         }
     }
 
-    // Advance time
+    // Advance time and fire all due timers, replaying every period a
+    // periodic timer spans in a large delta
     s_timer.sim_time_us += delta_us;
-
-    // Fire all due timers
-    // We need to iterate carefully since firing a timer may cause actor to
-    // create/cancel timers
-    bool fired_any;
-    do {
-        fired_any = false;
-        timer_entry *entry = s_timer.timers;
-        timer_entry *prev = NULL;
-
-        while (entry) {
-            timer_entry *next = entry->next;
-
-            // Check if timer is due (only for simulation mode timers)
-            if (entry->fd < 0 && entry->expiry_us <= s_timer.sim_time_us) {
-                // Get the actor
-                actor *a = hive_actor_get(entry->owner);
-                if (!a) {
-                    // Actor is dead - cleanup timer
-                    if (prev) {
-                        prev->next = next;
-                    } else {
-                        s_timer.timers = next;
-                    }
-                    hive_pool_free(&s_timer_pool_mgr, entry);
-                    entry = next;
-                    continue;
-                }
-
-                // Send timer tick message to actor
-                HIVE_LOG_DEBUG(
-                    "Timer %u fired for actor %u (sim_time=%lu, expiry=%lu)",
-                    entry->id, entry->owner, (unsigned long)s_timer.sim_time_us,
-                    (unsigned long)entry->expiry_us);
-
-                hive_status status = hive_ipc_notify_internal(
-                    entry->owner, entry->owner, HIVE_MSG_TIMER, entry->id, NULL,
-                    0);
-
-                if (HIVE_FAILED(status)) {
-                    HIVE_LOG_ERROR("Failed to send timer tick: %s", status.msg);
-                    prev = entry;
-                    entry = next;
-                    continue;
-                }
-
-                fired_any = true;
-
-                if (entry->periodic) {
-                    // Reschedule periodic timer
-                    entry->expiry_us += entry->interval_us;
-                    prev = entry;
-                } else {
-                    // Remove one-shot timer
-                    if (prev) {
-                        prev->next = next;
-                    } else {
-                        s_timer.timers = next;
-                    }
-                    hive_pool_free(&s_timer_pool_mgr, entry);
-                }
-            } else {
-                prev = entry;
-            }
-
-            entry = next;
-        }
-    } while (fired_any); // Repeat if we fired any (handles multiple fires for
-        // large delta)
+    fire_due_timers(s_timer.sim_time_us, true);
 }
 
 // Get current time in microseconds
@@ -360,7 +652,5 @@ uint64_t hive_get_time(void) {
         return s_timer.sim_time_us;
     }
 
-    struct timespec ts;
-    clock_gettime(CLOCK_MONOTONIC, &ts);
-    return (uint64_t)ts.tv_sec * 1000000 + (uint64_t)ts.tv_nsec / 1000;
+    return hive_clock_us();
 }
@@ -7,12 +7,18 @@
 #include "hive_runtime.h"
 #include "hive_ipc.h"
 #include "hive_log.h"
+#include "hive_timer_wheel.h"
+#include <stddef.h>
 #include <string.h>
 #include <stdbool.h>
 
-// STM32-specific timer implementation using a software timer wheel
+// STM32-specific timer implementation using a hierarchical timer wheel
 // Hardware timer (SysTick or TIMx) drives the tick at HIVE_TIMER_TICK_US
-// interval Default: 1000us (1ms) tick resolution
+// interval Default: 1000us (1ms) tick resolution. With an idle hook
+// installed (hive_timer_set_idle), the tick is suppressed while idle and
+// the hardware timer is reprogrammed to the next wheel event instead.
+// Blocked actors' wait deadlines sit in the same wheel, one static entry
+// per actor slot, so they never draw on the timer pool.
 
 #ifndef HIVE_TIMER_TICK_US
 #define HIVE_TIMER_TICK_US 1000 // 1ms tick
@@ -20,26 +26,38 @@
 
 // Active timer entry
 typedef struct timer_entry {
-    timer_id id;
+    timer_id id; // Kept after free: the slot's next id bumps its generation
     actor_id owner;
-    uint32_t expiry_ticks;   // When timer expires (absolute tick count)
-    uint32_t interval_ticks; // For periodic timers (0 = one-shot)
+    hive_timer_wheel_node node; // node.expiry: absolute tick count
+    uint32_t interval_ticks;    // For periodic timers (0 = one-shot)
     bool periodic;
-    struct timer_entry *next;
+    bool deadline; // Actor wait deadline: wakes the owner, no message
+    bool queued;   // Deadline filed in the wheel (timers always are)
+    uint32_t missed; // Periods lost to undelivered ticks, reported next
+    mailbox_entry *pending; // Periodic tick still queued in owner's mailbox
+    hive_timer_stats stats;
 } timer_entry;
 
+#define ENTRY_OF(n) \
+    ((timer_entry *)((char *)(n) - offsetof(timer_entry, node)))
+
 // Static pool for timer entries
 static timer_entry s_timer_pool[HIVE_TIMER_ENTRY_POOL_SIZE];
 static bool s_timer_used[HIVE_TIMER_ENTRY_POOL_SIZE];
 static hive_pool s_timer_pool_mgr;
 
+// Wait deadline per actor slot (indexed like the actor table)
+static timer_entry s_deadlines[HIVE_MAX_ACTORS];
+
+extern actor_table *hive_actor_get_table(void);
+
 // Timer subsystem state
 static struct {
     bool initialized;
-    timer_entry *timers; // Active timers list (sorted by expiry)
-    timer_id next_id;
+    hive_timer_wheel wheel;       // Active timers, processed up to wheel.now
     volatile uint32_t tick_count; // Current tick count (updated by ISR)
     volatile bool tick_pending;   // Set by ISR, cleared by scheduler
+    hive_timer_idle_fn idle;      // Tickless idle hook (NULL = plain WFI)
 } s_timer = {0};
 
 // Convert microseconds to ticks (rounding up)
@@ -47,6 +65,16 @@ static uint32_t us_to_ticks(uint32_t us) {
     return (us + HIVE_TIMER_TICK_US - 1) / HIVE_TIMER_TICK_US;
 }
 
+// O(1) lookup: the id names the slot, the generation rejects stale ids
+static timer_entry *find_timer(timer_id id) {
+    size_t slot = hive_timer_id_slot(id);
+    if (slot >= HIVE_TIMER_ENTRY_POOL_SIZE || !s_timer_used[slot] ||
+        s_timer_pool[slot].id != id) {
+        return NULL;
+    }
+    return &s_timer_pool[slot];
+}
+
 // Called by hardware timer ISR (SysTick or TIMx)
 // This function must be called from the timer interrupt handler
 void hive_timer_tick_isr(void) {
@@ -59,6 +87,45 @@ uint32_t hive_timer_get_ticks(void) {
     return s_timer.tick_count;
 }
 
+// Board setup installs the hook, so it may precede hive_init() and outlives
+// hive_cleanup()
+void hive_timer_set_idle(hive_timer_idle_fn idle) {
+    s_timer.idle = idle;
+}
+
+// Sleep until the next wheel event or any interrupt (scheduler idle path)
+// Interrupts stay masked from reading the tick count to the hook's WFI, so
+// a tick that lands in between is seen (tick_pending) rather than slept
+// through; WFI still wakes on a masked pending interrupt, whose handler
+// runs once they are unmasked again.
+void hive_timer_idle(void) {
+    if (!s_timer.idle) {
+        __asm__ volatile("wfi");
+        return;
+    }
+
+    __asm__ volatile("cpsid i" ::: "memory");
+    if (!s_timer.tick_pending) {
+        uint32_t ticks = 0; // No timer pending: sleep until an interrupt
+        uint32_t tick;
+        if (hive_timer_wheel_next(&s_timer.wheel, &tick)) {
+            int32_t delta = (int32_t)(tick - s_timer.tick_count);
+            ticks = delta > 0 ? (uint32_t)delta : 0;
+            if (ticks == 0) {
+                s_timer.tick_pending = true; // Already due: don't sleep
+            }
+        }
+        if (!s_timer.tick_pending) {
+            uint32_t slept = s_timer.idle(ticks);
+            if (slept > 0) {
+                s_timer.tick_count += slept;
+                s_timer.tick_pending = true;
+            }
+        }
+    }
+    __asm__ volatile("cpsie i" ::: "memory");
+}
+
 // Process expired timers (called by scheduler in main loop)
 void hive_timer_process_pending(void) {
     if (!s_timer.tick_pending) {
@@ -68,32 +135,78 @@ void hive_timer_process_pending(void) {
 
     uint32_t now = s_timer.tick_count;
 
-    // Process all expired timers
-    timer_entry **pp = &s_timer.timers;
-    while (*pp) {
-        timer_entry *entry = *pp;
-
-        // Check if timer expired (handle wrap-around)
-        int32_t delta = (int32_t)(entry->expiry_ticks - now);
-        if (delta <= 0) {
-            // Timer expired - send message to owner
-            actor *a = hive_actor_get(entry->owner);
-            if (a) {
-                hive_ipc_notify_internal(entry->owner, entry->owner,
-                                         HIVE_MSG_TIMER, entry->id, NULL, 0);
+    // Collect every timer due by now; the wheel only visits occupied slots
+    hive_timer_wheel_advance(&s_timer.wheel, now);
+    hive_timer_wheel_node *node;
+    while ((node = hive_timer_wheel_pop(&s_timer.wheel))) {
+        timer_entry *entry = ENTRY_OF(node);
+        int32_t delta = (int32_t)(node->expiry - now);
+
+        if (entry->deadline) {
+            // Wake the owner if it is still blocked on this deadline
+            entry->queued = false;
+            actor *a = &hive_actor_get_table()->actors[entry - s_deadlines];
+            if (a->id == entry->owner && a->state == ACTOR_STATE_WAITING) {
+                a->state = ACTOR_STATE_READY;
             }
+            continue;
+        }
+
+        actor *a = hive_actor_get(entry->owner);
+        if (!a) {
+            // Remove dead actor's timer
+            hive_pool_free(&s_timer_pool_mgr, entry);
+            continue;
+        }
 
-            if (entry->periodic && a) {
-                // Reschedule periodic timer
-                entry->expiry_ticks = now + entry->interval_ticks;
-                pp = &entry->next;
-            } else {
-                // Remove one-shot or dead actor's timer
-                *pp = entry->next;
-                hive_pool_free(&s_timer_pool_mgr, entry);
+        // A periodic timer that fell behind delivers one tick for its
+        // latest due period and reports the ones in between as missed.
+        // Due times stay on the start + k * interval grid (no drift).
+        uint32_t late = (uint32_t)-delta;
+        uint32_t missed = entry->missed;
+        if (entry->periodic) {
+            missed += late / entry->interval_ticks;
+            late %= entry->interval_ticks;
+        }
+
+        if (entry->periodic && entry->pending) {
+            // Previous tick not received yet: fold this expiration into it
+            // rather than queueing another (at most one tick per timer)
+            hive_timer_tick_add_missed(entry->pending, missed + 1);
+            entry->stats.missed += missed + 1;
+            entry->missed = 0;
+            hive_timer_wheel_insert(&s_timer.wheel, node,
+                                    now - late + entry->interval_ticks);
+            continue;
+        }
+
+        // Timer expired - send message to owner (periodic ticks carry the
+        // missed period count as payload)
+        hive_status status = hive_ipc_notify_tick(
+            entry->owner, entry->id, entry->periodic ? &missed : NULL,
+            entry->periodic ? sizeof(missed) : 0,
+            entry->periodic ? &entry->pending : NULL);
+        if (HIVE_SUCCEEDED(status)) {
+            uint32_t late_us = late * HIVE_TIMER_TICK_US;
+            entry->stats.ticks++;
+            entry->stats.missed += missed;
+            entry->stats.total_late_us += late_us;
+            entry->stats.last_late_us = late_us;
+            if (late_us > entry->stats.max_late_us) {
+                entry->stats.max_late_us = late_us;
             }
+            entry->missed = 0;
+        } else if (entry->periodic) {
+            entry->missed = missed + 1; // This period is lost too
+        }
+
+        if (entry->periodic) {
+            // Next period boundary after now
+            hive_timer_wheel_insert(&s_timer.wheel, node,
+                                    now - late + entry->interval_ticks);
         } else {
-            pp = &entry->next;
+            // Remove one-shot timer (already unlinked by the pop)
+            hive_pool_free(&s_timer_pool_mgr, entry);
         }
     }
 }
@@ -114,10 +227,13 @@ hive_status hive_timer_init(void) {
                    sizeof(timer_entry), HIVE_TIMER_ENTRY_POOL_SIZE);
 
     // Initialize timer state
-    s_timer.timers = NULL;
-    s_timer.next_id = 1;
     s_timer.tick_count = 0;
     s_timer.tick_pending = false;
+    hive_timer_wheel_init(&s_timer.wheel, 0);
+    for (size_t i = 0; i < HIVE_MAX_ACTORS; i++) {
+        s_deadlines[i].deadline = true;
+        s_deadlines[i].queued = false;
+    }
 
     // Hardware timer initialization should be done by the application
     // (e.g., configure SysTick to call hive_timer_tick_isr every
@@ -132,20 +248,19 @@ void hive_timer_cleanup(void) {
     HIVE_CLEANUP_GUARD(s_timer.initialized);
 
     // Clean up all active timers
-    timer_entry *entry = s_timer.timers;
-    while (entry) {
-        timer_entry *next = entry->next;
-        hive_pool_free(&s_timer_pool_mgr, entry);
-        entry = next;
+    for (size_t i = 0; i < HIVE_TIMER_ENTRY_POOL_SIZE; i++) {
+        if (s_timer_used[i]) {
+            hive_pool_free(&s_timer_pool_mgr, &s_timer_pool[i]);
+        }
     }
-    s_timer.timers = NULL;
+    hive_timer_wheel_init(&s_timer.wheel, 0);
 
     s_timer.initialized = false;
 }
 
-// Create a timer (one-shot or periodic)
-static hive_status create_timer(uint32_t interval_us, bool periodic,
-                                timer_id *out) {
+// Create a timer (one-shot or periodic) first due at 'expiry_ticks'
+static hive_status create_timer(uint32_t expiry_ticks, uint32_t interval_ticks,
+                                bool periodic, timer_id *out) {
     if (!out) {
         return HIVE_ERROR(HIVE_ERR_INVALID, "NULL out pointer");
     }
@@ -161,62 +276,177 @@ static hive_status create_timer(uint32_t interval_us, bool periodic,
         return HIVE_ERROR(HIVE_ERR_NOMEM, "Timer entry pool exhausted");
     }
 
-    // Calculate expiry
-    uint32_t ticks = us_to_ticks(interval_us);
-    if (ticks == 0)
-        ticks = 1; // Minimum 1 tick
-
     // Initialize timer entry
-    entry->id = s_timer.next_id++;
+    entry->id = hive_timer_next_id((size_t)(entry - s_timer_pool), entry->id);
     entry->owner = current->id;
-    entry->expiry_ticks = s_timer.tick_count + ticks;
-    entry->interval_ticks = periodic ? ticks : 0;
+    entry->interval_ticks = periodic ? interval_ticks : 0;
     entry->periodic = periodic;
-
-    // Insert into list (simple append - could optimize with sorted insert)
-    entry->next = s_timer.timers;
-    s_timer.timers = entry;
+    entry->deadline = false;
+    entry->missed = 0;
+    entry->pending = NULL;
+    memset(&entry->stats, 0, sizeof(entry->stats));
+
+    // O(1) insert; an expiry already reached is delivered on the next pass
+    if (hive_timer_wheel_insert(&s_timer.wheel, &entry->node, expiry_ticks)) {
+        s_timer.tick_pending = true;
+    }
 
     *out = entry->id;
     return HIVE_SUCCESS;
 }
 
+// Interval in ticks (minimum 1 tick)
+static uint32_t interval_ticks(uint32_t interval_us) {
+    uint32_t ticks = us_to_ticks(interval_us);
+    return ticks ? ticks : 1;
+}
+
 hive_status hive_timer_after(uint32_t delay_us, timer_id *out) {
-    return create_timer(delay_us, false, out);
+    uint32_t ticks = interval_ticks(delay_us);
+    return create_timer(s_timer.tick_count + ticks, ticks, false, out);
+}
+
+// Slack timers expire on a multiple of the largest power of two that fits
+// in the slack, so loosely timed timers land on the same ticks and fire in
+// one batch (the rounding never exceeds the slack)
+hive_status hive_timer_after_slack(uint32_t delay_us, uint32_t slack_us,
+                                   timer_id *out) {
+    uint32_t ticks = interval_ticks(delay_us);
+    uint32_t expiry = s_timer.tick_count + ticks;
+    uint32_t slack = slack_us / HIVE_TIMER_TICK_US;
+    if (slack > 0) {
+        uint32_t align = 1;
+        while (align <= slack / 2) {
+            align <<= 1;
+        }
+        expiry = (expiry + align - 1) & ~(align - 1);
+    }
+    return create_timer(expiry, ticks, false, out);
 }
 
 hive_status hive_timer_every(uint32_t interval_us, timer_id *out) {
-    return create_timer(interval_us, true, out);
+    if (interval_us == 0) {
+        return HIVE_ERROR(HIVE_ERR_INVALID, "Zero interval");
+    }
+    uint32_t ticks = interval_ticks(interval_us);
+    return create_timer(s_timer.tick_count + ticks, ticks, true, out);
+}
+
+hive_status hive_timer_every_abs(uint64_t start_us, uint32_t interval_us,
+                                 timer_id *out) {
+    if (interval_us == 0) {
+        return HIVE_ERROR(HIVE_ERR_INVALID, "Zero interval");
+    }
+    // Start rounds up to the next tick (same timebase as hive_get_time)
+    uint32_t start = (uint32_t)((start_us + HIVE_TIMER_TICK_US - 1) /
+                                HIVE_TIMER_TICK_US);
+    return create_timer(start, interval_ticks(interval_us), true, out);
+}
+
+// Next wheel event: the earliest expiry, or a cascade point before it that
+// the caller simply advances through
+bool hive_timer_next_deadline(uint64_t *deadline_us) {
+    uint32_t tick;
+    if (!s_timer.initialized || !hive_timer_wheel_next(&s_timer.wheel, &tick)) {
+        return false;
+    }
+    uint32_t now = s_timer.tick_count;
+    int32_t delta = (int32_t)(tick - now);
+    uint64_t ticks = (uint64_t)now + (uint64_t)(delta > 0 ? delta : 0);
+    *deadline_us = ticks * HIVE_TIMER_TICK_US;
+    return true;
+}
+
+void hive_timer_tick_dequeued(timer_id id, const mailbox_entry *entry) {
+    timer_entry *timer = find_timer(id);
+    if (timer && timer->pending == entry) {
+        timer->pending = NULL;
+    }
+}
+
+hive_status hive_timer_get_stats(timer_id id, hive_timer_stats *out) {
+    if (!out) {
+        return HIVE_ERROR(HIVE_ERR_INVALID, "NULL out pointer");
+    }
+
+    HIVE_REQUIRE_INIT(s_timer.initialized, "Timer");
+
+    timer_entry *entry = find_timer(id);
+    if (!entry) {
+        return HIVE_ERROR(HIVE_ERR_INVALID, "Timer not found");
+    }
+
+    *out = entry->stats;
+    return HIVE_SUCCESS;
+}
+
+// Timers fire from the tick ISR: there is no early wakeup to spin after
+hive_status hive_timer_set_spin(uint32_t spin_us) {
+    (void)spin_us;
+    HIVE_REQUIRE_INIT(s_timer.initialized, "Timer");
+    return HIVE_SUCCESS;
 }
 
 hive_status hive_timer_cancel(timer_id id) {
     HIVE_REQUIRE_INIT(s_timer.initialized, "Timer");
 
-    // Find and remove timer from list
-    timer_entry *found = NULL;
-    SLIST_FIND_REMOVE(s_timer.timers, entry->id == id, found);
+    timer_entry *entry = find_timer(id);
+    if (!entry) {
+        return HIVE_ERROR(HIVE_ERR_INVALID, "Timer not found");
+    }
 
-    if (found) {
-        hive_pool_free(&s_timer_pool_mgr, found);
-        return HIVE_SUCCESS;
+    hive_timer_wheel_remove(&s_timer.wheel, &entry->node);
+    hive_pool_free(&s_timer_pool_mgr, entry);
+    return HIVE_SUCCESS;
+}
+
+static timer_entry *deadline_of(const actor *a) {
+    return &s_deadlines[a - hive_actor_get_table()->actors];
+}
+
+// The deadline rounds up to the next tick (same timebase as hive_get_time)
+void hive_timer_deadline_arm(actor *a, uint64_t deadline_us) {
+    timer_entry *entry = deadline_of(a);
+    if (entry->queued) {
+        hive_timer_wheel_remove(&s_timer.wheel, &entry->node);
     }
+    entry->owner = a->id;
+    entry->queued = true;
+    uint32_t expiry = (uint32_t)((deadline_us + HIVE_TIMER_TICK_US - 1) /
+                                 HIVE_TIMER_TICK_US);
+    if (hive_timer_wheel_insert(&s_timer.wheel, &entry->node, expiry)) {
+        s_timer.tick_pending = true;
+    }
+}
 
-    return HIVE_ERROR(HIVE_ERR_INVALID, "Timer not found");
+bool hive_timer_deadline_pending(const actor *a) {
+    return deadline_of(a)->queued;
+}
+
+void hive_timer_deadline_cancel(actor *a) {
+    timer_entry *entry = deadline_of(a);
+    if (entry->queued) {
+        hive_timer_wheel_remove(&s_timer.wheel, &entry->node);
+        entry->queued = false;
+    }
 }
 
 hive_status hive_sleep(uint32_t delay_us) {
-    // Create one-shot timer
-    timer_id timer;
-    hive_status s = hive_timer_after(delay_us, &timer);
-    if (HIVE_FAILED(s)) {
-        return s;
-    }
-
-    // Wait specifically for THIS timer message
-    // Other messages remain in mailbox (selective receive)
-    hive_message msg;
-    return hive_ipc_recv_match(HIVE_SENDER_ANY, HIVE_MSG_TIMER, timer, &msg,
-                               -1);
+    return hive_sleep_until(hive_get_time() + delay_us);
+}
+
+hive_status hive_sleep_until(uint64_t deadline_us) {
+    HIVE_REQUIRE_INIT(s_timer.initialized, "Timer");
+    HIVE_REQUIRE_ACTOR_CONTEXT();
+    actor *current = hive_actor_current();
+
+    // Messages arriving meanwhile wake the actor; they stay queued
+    hive_timer_deadline_arm(current, deadline_us);
+    while (hive_timer_deadline_pending(current)) {
+        current->state = ACTOR_STATE_WAITING;
+        hive_scheduler_yield();
+    }
+    return HIVE_SUCCESS;
 }
 
 // Advance simulation time (microseconds) and process expired timers
@@ -0,0 +1,160 @@
+#include "hive_timer_wheel.h"
+#include <stddef.h>
+
+#define SLOT_MASK (HIVE_TIMER_WHEEL_SLOTS - 1)
+#define EXPIRED_BUCKET (HIVE_TIMER_WHEEL_LEVELS * HIVE_TIMER_WHEEL_SLOTS)
+
+static void bucket_push(hive_timer_wheel *w, hive_timer_wheel_node *node,
+                        uint16_t bucket) {
+    node->bucket = bucket;
+    node->prev = NULL;
+    node->next = w->slots[bucket];
+    if (node->next) {
+        node->next->prev = node;
+    }
+    w->slots[bucket] = node;
+    if (bucket != EXPIRED_BUCKET) {
+        w->occupied[bucket / HIVE_TIMER_WHEEL_SLOTS] |=
+            1u << (bucket & SLOT_MASK);
+    }
+}
+
+// File by distance: level k spans up to 32^(k+1) ticks, and a node exactly
+// one span away shares the slot just processed, which comes round again at
+// its expiry
+static void file_node(hive_timer_wheel *w, hive_timer_wheel_node *node) {
+    uint32_t delta = node->expiry - w->now; // >= 1
+    uint32_t level = 0;
+    if (delta > 1) {
+        level = (uint32_t)(31 - __builtin_clz(delta - 1)) /
+                HIVE_TIMER_WHEEL_BITS;
+    }
+    uint32_t slot =
+        (node->expiry >> (level * HIVE_TIMER_WHEEL_BITS)) & SLOT_MASK;
+    bucket_push(w, node, (uint16_t)(level * HIVE_TIMER_WHEEL_SLOTS + slot));
+}
+
+void hive_timer_wheel_init(hive_timer_wheel *w, uint32_t now) {
+    w->now = now;
+    for (size_t i = 0; i < HIVE_TIMER_WHEEL_LEVELS; i++) {
+        w->occupied[i] = 0;
+    }
+    for (size_t i = 0; i <= EXPIRED_BUCKET; i++) {
+        w->slots[i] = NULL;
+    }
+}
+
+bool hive_timer_wheel_insert(hive_timer_wheel *w, hive_timer_wheel_node *node,
+                             uint32_t expiry) {
+    node->expiry = expiry;
+    if ((int32_t)(expiry - w->now) <= 0) {
+        bucket_push(w, node, EXPIRED_BUCKET);
+        return true;
+    }
+    file_node(w, node);
+    return false;
+}
+
+void hive_timer_wheel_remove(hive_timer_wheel *w, hive_timer_wheel_node *node) {
+    if (node->prev) {
+        node->prev->next = node->next;
+    } else {
+        w->slots[node->bucket] = node->next;
+        if (!node->next && node->bucket != EXPIRED_BUCKET) {
+            w->occupied[node->bucket / HIVE_TIMER_WHEEL_SLOTS] &=
+                ~(1u << (node->bucket & SLOT_MASK));
+        }
+    }
+    if (node->next) {
+        node->next->prev = node->prev;
+    }
+}
+
+// Detach a whole slot list
+static hive_timer_wheel_node *take_slot(hive_timer_wheel *w, uint32_t level,
+                                        uint32_t slot) {
+    hive_timer_wheel_node *list =
+        w->slots[level * HIVE_TIMER_WHEEL_SLOTS + slot];
+    w->slots[level * HIVE_TIMER_WHEEL_SLOTS + slot] = NULL;
+    w->occupied[level] &= ~(1u << slot);
+    return list;
+}
+
+// Earliest tick after 'now' at which an occupied slot comes due: for level
+// 0 the expiry itself, above it the start of the slot (when it cascades).
+// Slots at or below the current index belong to the next lap.
+static bool next_slot_tick(const hive_timer_wheel *w, uint32_t *tick) {
+    bool found = false;
+    uint32_t best = 0;
+    for (uint32_t level = 0; level < HIVE_TIMER_WHEEL_LEVELS; level++) {
+        uint32_t occ = w->occupied[level];
+        if (!occ) {
+            continue;
+        }
+        uint32_t shift = level * HIVE_TIMER_WHEEL_BITS;
+        uint32_t cur = (w->now >> shift) & SLOT_MASK;
+        // Rotate so bit 0 is the slot after the current one
+        uint32_t rot = cur == SLOT_MASK
+                           ? occ
+                           : (occ >> (cur + 1)) | (occ << (SLOT_MASK - cur));
+        uint32_t ahead = (uint32_t)__builtin_ctz(rot) + 1;
+        uint32_t start =
+            (uint32_t)((((uint64_t)(w->now >> shift)) + ahead) << shift);
+        uint32_t dist = start - w->now;
+        if (!found || dist < best) {
+            best = dist;
+            found = true;
+        }
+    }
+    *tick = w->now + best;
+    return found;
+}
+
+void hive_timer_wheel_advance(hive_timer_wheel *w, uint32_t now) {
+    uint32_t tick;
+    while (next_slot_tick(w, &tick) && (int32_t)(tick - now) <= 0) {
+        // Nothing is filed before 'tick': jump there and cascade every level
+        // whose slot starts at it. Refiled nodes land on lower levels (those
+        // due at 'tick' itself in level 0), so level 0 is collected last.
+        w->now = tick - 1;
+        for (uint32_t level = 1; level < HIVE_TIMER_WHEEL_LEVELS; level++) {
+            uint32_t shift = level * HIVE_TIMER_WHEEL_BITS;
+            if (tick & ((1u << shift) - 1)) {
+                break;
+            }
+            hive_timer_wheel_node *node =
+                take_slot(w, level, (tick >> shift) & SLOT_MASK);
+            while (node) {
+                hive_timer_wheel_node *next = node->next;
+                file_node(w, node);
+                node = next;
+            }
+        }
+        hive_timer_wheel_node *node = take_slot(w, 0, tick & SLOT_MASK);
+        while (node) {
+            hive_timer_wheel_node *next = node->next;
+            bucket_push(w, node, EXPIRED_BUCKET);
+            node = next;
+        }
+        w->now = tick;
+    }
+    if ((int32_t)(now - w->now) > 0) {
+        w->now = now;
+    }
+}
+
+hive_timer_wheel_node *hive_timer_wheel_pop(hive_timer_wheel *w) {
+    hive_timer_wheel_node *node = w->slots[EXPIRED_BUCKET];
+    if (node) {
+        hive_timer_wheel_remove(w, node);
+    }
+    return node;
+}
+
+bool hive_timer_wheel_next(const hive_timer_wheel *w, uint32_t *tick) {
+    if (w->slots[EXPIRED_BUCKET]) {
+        *tick = w->now;
+        return true;
+    }
+    return next_slot_tick(w, tick);
+}
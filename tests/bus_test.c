@@ -3,6 +3,7 @@
 #include "hive_ipc.h"
 #include "hive_timer.h"
 #include "hive_link.h"
+#include <stddef.h>
 #include <stdio.h>
 #include <string.h>
 
@@ -692,6 +693,22 @@ static void test11_subscribe_destroyed_bus(void *args,
         TEST_FAIL("subscribe to destroyed bus should fail");
     }
 
+    // A new bus reuses the freed slot; the old id must not reach it
+    bus_id reused;
+    status = hive_bus_create(&cfg, &reused);
+    if (HIVE_FAILED(status)) {
+        TEST_FAIL("hive_bus_create (reuse)");
+        hive_exit();
+    }
+    if (reused != bus && HIVE_FAILED(hive_bus_publish(bus, "x", 1)) &&
+        hive_bus_entry_count(reused) == 0 &&
+        HIVE_SUCCEEDED(hive_bus_publish(reused, "x", 1))) {
+        TEST_PASS("stale id rejected after its slot is reused");
+    } else {
+        TEST_FAIL("stale id reached the bus that reused its slot");
+    }
+    hive_bus_destroy(reused);
+
     hive_exit();
 }
 
@@ -755,11 +772,1094 @@ static void test12_buffer_overflow_protection(void *args,
         TEST_FAIL("buffer overflow not prevented");
     }
 
+    // The blocking read reports truncation like hive_bus_read()
+    hive_bus_publish(bus, large_msg, sizeof(large_msg));
+    memset(small_buf, 0, sizeof(small_buf));
+    actual_len = 0;
+    status = hive_bus_read_wait_until(bus, small_buf, sizeof(small_buf),
+                                      &actual_len, HIVE_DEADLINE_NOW);
+    if (status.code == HIVE_ERR_TRUNCATED &&
+        actual_len == sizeof(small_buf) && small_buf[0] == 'X') {
+        TEST_PASS("hive_bus_read_wait_until returns TRUNCATED");
+    } else {
+        printf("    code=%d actual_len=%zu\n", status.code, actual_len);
+        TEST_FAIL("hive_bus_read_wait_until truncation not reported");
+    }
+
+    hive_bus_unsubscribe(bus);
+    hive_bus_destroy(bus);
+    hive_exit();
+}
+
+// ============================================================================
+// Test 13: Sequence cursors report exact overrun
+// ============================================================================
+
+static void test13_overrun_missed(void *args, const hive_spawn_info *siblings,
+                                  size_t sibling_count) {
+    (void)args;
+    (void)siblings;
+    (void)sibling_count;
+    printf("\nTest 13: Sequence cursors report exact overrun\n");
+    fflush(stdout);
+
+    hive_bus_config cfg = TEST_BUS_CONFIG;
+    cfg.max_entries = 4;
+    bus_id bus;
+    if (HIVE_FAILED(hive_bus_create(&cfg, &bus))) {
+        TEST_FAIL("hive_bus_create");
+        hive_exit();
+    }
+
+    // Entries published before subscribing stay invisible
+    hive_bus_publish(bus, "old", 4);
+    hive_bus_subscribe(bus);
+    char buf[32];
+    size_t len;
+    hive_status status = hive_bus_read(bus, buf, sizeof(buf), &len);
+    if (status.code == HIVE_ERR_WOULDBLOCK) {
+        TEST_PASS("new subscriber starts at the next publish");
+    } else {
+        TEST_FAIL("new subscriber read history");
+    }
+
+    // Overrun a 4-entry ring by 6: the next read is the oldest survivor and
+    // exactly 6 entries are reported missed
+    for (int i = 1; i <= 10; i++) {
+        snprintf(buf, sizeof(buf), "Message %d", i);
+        hive_bus_publish(bus, buf, strlen(buf) + 1);
+    }
+    uint64_t missed = 0;
+    status = hive_bus_read(bus, buf, sizeof(buf), &len);
+    hive_bus_missed(bus, &missed);
+    if (HIVE_SUCCEEDED(status) && strcmp(buf, "Message 7") == 0 &&
+        missed == 6) {
+        TEST_PASS("overrun skips to oldest entry, 6 missed");
+    } else {
+        printf("    read '%s', missed %llu\n", buf,
+               (unsigned long long)missed);
+        TEST_FAIL("overrun accounting");
+    }
+
+    // The count resets, and reading on in order misses nothing
+    int reads = 0;
+    while (HIVE_SUCCEEDED(hive_bus_read(bus, buf, sizeof(buf), &len))) {
+        reads++;
+    }
+    hive_bus_missed(bus, &missed);
+    if (reads == 3 && missed == 0) {
+        TEST_PASS("in-order reads report nothing missed");
+    } else {
+        printf("    %d reads, missed %llu\n", reads,
+               (unsigned long long)missed);
+        TEST_FAIL("missed count after catch-up");
+    }
+
+    // Losses are counted before the subscriber reads again
+    for (int i = 0; i < 5; i++) {
+        hive_bus_publish(bus, "x", 2);
+    }
+    hive_bus_missed(bus, &missed);
+    if (missed == 1) {
+        TEST_PASS("missed counts evictions not yet read past");
+    } else {
+        printf("    missed %llu (expected 1)\n", (unsigned long long)missed);
+        TEST_FAIL("missed before read");
+    }
+
     hive_bus_unsubscribe(bus);
     hive_bus_destroy(bus);
     hive_exit();
 }
 
+// ============================================================================
+// Test 14: Blocked subscribers are woken, killed ones are unlinked
+// ============================================================================
+
+#ifdef QEMU_TEST_STACK_SIZE
+#define FANOUT_SUBS 3
+#else
+#define FANOUT_SUBS 16
+#endif
+
+static bus_id s_fanout_bus;
+static int s_fanout_subscribed;
+static int s_fanout_received;
+
+static void fanout_subscriber(void *args, const hive_spawn_info *siblings,
+                              size_t sibling_count) {
+    (void)args;
+    (void)siblings;
+    (void)sibling_count;
+    if (HIVE_FAILED(hive_bus_subscribe(s_fanout_bus))) {
+        hive_exit();
+    }
+    s_fanout_subscribed++;
+
+    char buf[32];
+    size_t len;
+    if (HIVE_SUCCEEDED(
+            hive_bus_read_wait(s_fanout_bus, buf, sizeof(buf), &len, 1000))) {
+        s_fanout_received++;
+    }
+    hive_bus_unsubscribe(s_fanout_bus);
+    hive_exit();
+}
+
+static void test14_blocked_fanout(void *args, const hive_spawn_info *siblings,
+                                  size_t sibling_count) {
+    (void)args;
+    (void)siblings;
+    (void)sibling_count;
+    printf("\nTest 14: Blocked subscribers woken, killed ones unlinked\n");
+    fflush(stdout);
+
+    hive_bus_config cfg = TEST_BUS_CONFIG;
+    if (HIVE_FAILED(hive_bus_create(&cfg, &s_fanout_bus))) {
+        TEST_FAIL("hive_bus_create");
+        hive_exit();
+    }
+    s_fanout_subscribed = 0;
+    s_fanout_received = 0;
+
+    actor_config acfg = HIVE_ACTOR_CONFIG_DEFAULT;
+    acfg.stack_size = TEST_STACK_SIZE(16 * 1024);
+    actor_id subs[FANOUT_SUBS];
+    for (int i = 0; i < FANOUT_SUBS; i++) {
+        hive_spawn(fanout_subscriber, NULL, NULL, &acfg, &subs[i]);
+    }
+    hive_sleep(20000); // All subscribe and block
+
+    // Kill every other blocked subscriber: each must leave the bus's
+    // blocked list before its actor slot can be reused
+    int killed = 0;
+    for (int i = 0; i < FANOUT_SUBS; i += 2) {
+        hive_kill(subs[i]);
+        killed++;
+    }
+
+    hive_bus_publish(s_fanout_bus, "wake", 5);
+    hive_sleep(20000);
+
+    if (s_fanout_subscribed == FANOUT_SUBS &&
+        s_fanout_received == FANOUT_SUBS - killed) {
+        TEST_PASS("one publish woke every surviving blocked subscriber");
+    } else {
+        printf("    %d subscribed, %d received (expected %d)\n",
+               s_fanout_subscribed, s_fanout_received, FANOUT_SUBS - killed);
+        TEST_FAIL("fan-out wakeup");
+    }
+
+    if (HIVE_SUCCEEDED(hive_bus_destroy(s_fanout_bus))) {
+        TEST_PASS("killed and departed subscriptions all released");
+    } else {
+        TEST_FAIL("bus still has subscribers");
+    }
+    hive_exit();
+}
+
+// ============================================================================
+// Test 15: Latest-value bus keeps only the newest sample
+// ============================================================================
+
+static void test15_latest_value(void *args, const hive_spawn_info *siblings,
+                                size_t sibling_count) {
+    (void)args;
+    (void)siblings;
+    (void)sibling_count;
+    printf("\nTest 15: Latest-value bus keeps only the newest sample\n");
+    fflush(stdout);
+
+    hive_bus_config cfg = TEST_BUS_CONFIG;
+    cfg.mode = HIVE_BUS_LATEST;
+    cfg.consume_after_reads = 1;
+    bus_id bus;
+    hive_status status = hive_bus_create(&cfg, &bus);
+    if (status.code == HIVE_ERR_INVALID) {
+        TEST_PASS("consume_after_reads rejected on a latest-value bus");
+    } else {
+        TEST_FAIL("latest-value bus accepted consume_after_reads");
+    }
+
+    cfg.consume_after_reads = 0;
+    if (HIVE_FAILED(hive_bus_create(&cfg, &bus))) {
+        TEST_FAIL("hive_bus_create");
+        hive_exit();
+    }
+    hive_bus_subscribe(bus);
+
+    char buf[32];
+    size_t len;
+    bool fresh = true;
+    status = hive_bus_read_latest(bus, buf, sizeof(buf), &len, &fresh);
+    if (status.code == HIVE_ERR_WOULDBLOCK) {
+        TEST_PASS("nothing to read before the first publish");
+    } else {
+        TEST_FAIL("read_latest on an empty bus");
+    }
+
+    // Five publishes overwrite one slot: one read sees the last, four missed
+    for (int i = 1; i <= 5; i++) {
+        snprintf(buf, sizeof(buf), "Sample %d", i);
+        hive_bus_publish(bus, buf, strlen(buf) + 1);
+    }
+    uint64_t missed = 0;
+    status = hive_bus_read(bus, buf, sizeof(buf), &len);
+    hive_bus_missed(bus, &missed);
+    if (HIVE_SUCCEEDED(status) && strcmp(buf, "Sample 5") == 0 &&
+        missed == 4 && hive_bus_entry_count(bus) == 1) {
+        TEST_PASS("read returns the newest sample, 4 overwritten");
+    } else {
+        printf("    read '%s', missed %llu\n", buf,
+               (unsigned long long)missed);
+        TEST_FAIL("latest-value read");
+    }
+
+    // Already read: read blocks, read_latest repeats it as not fresh
+    status = hive_bus_read(bus, buf, sizeof(buf), &len);
+    hive_status latest =
+        hive_bus_read_latest(bus, buf, sizeof(buf), &len, &fresh);
+    if (status.code == HIVE_ERR_WOULDBLOCK && HIVE_SUCCEEDED(latest) &&
+        !fresh && strcmp(buf, "Sample 5") == 0) {
+        TEST_PASS("read_latest repeats a read sample as not fresh");
+    } else {
+        TEST_FAIL("re-reading the latest sample");
+    }
+
+    hive_bus_publish(bus, "Sample 6", 9);
+    latest = hive_bus_read_latest(bus, buf, sizeof(buf), &len, &fresh);
+    hive_bus_missed(bus, &missed);
+    if (HIVE_SUCCEEDED(latest) && fresh && strcmp(buf, "Sample 6") == 0 &&
+        missed == 0) {
+        TEST_PASS("read_latest flags a new sample as fresh");
+    } else {
+        TEST_FAIL("fresh flag");
+    }
+
+    // A rate limit does not hide a value that was never delivered
+    hive_bus_unsubscribe(bus);
+    hive_bus_sub_opts opts = HIVE_BUS_SUB_OPTS_DEFAULT;
+    opts.min_interval_us = 10000000;
+    hive_bus_subscribe_ex(bus, &opts);
+    hive_bus_publish(bus, "Sample 7", 9);
+    hive_bus_read_latest(bus, buf, sizeof(buf), &len, &fresh);
+    hive_bus_publish(bus, "Sample 8", 9);
+    latest = hive_bus_read_latest(bus, buf, sizeof(buf), &len, &fresh);
+    bool again_fresh = true;
+    hive_bus_read_latest(bus, buf, sizeof(buf), &len, &again_fresh);
+    if (HIVE_SUCCEEDED(latest) && fresh && !again_fresh &&
+        strcmp(buf, "Sample 8") == 0) {
+        TEST_PASS("read_latest flags fresh data inside a rate-limit interval");
+    } else {
+        TEST_FAIL("fresh flag with a rate limit");
+    }
+
+    // read_latest is only for latest-value buses
+    hive_bus_config ring_cfg = TEST_BUS_CONFIG;
+    bus_id ring;
+    hive_bus_create(&ring_cfg, &ring);
+    hive_bus_subscribe(ring);
+    status = hive_bus_read_latest(ring, buf, sizeof(buf), &len, NULL);
+    if (status.code == HIVE_ERR_INVALID) {
+        TEST_PASS("read_latest rejects a ring bus");
+    } else {
+        TEST_FAIL("read_latest on a ring bus");
+    }
+    hive_bus_unsubscribe(ring);
+    hive_bus_destroy(ring);
+
+    hive_bus_unsubscribe(bus);
+    hive_bus_destroy(bus);
+    hive_exit();
+}
+
+// ============================================================================
+// Test 16: Borrowed entries survive eviction, consumption and overwrite
+// ============================================================================
+
+static void test16_read_ref(void *args, const hive_spawn_info *siblings,
+                            size_t sibling_count) {
+    (void)args;
+    (void)siblings;
+    (void)sibling_count;
+    printf("\nTest 16: Borrowed entries outlive eviction until released\n");
+    fflush(stdout);
+
+    hive_bus_config cfg = TEST_BUS_CONFIG;
+    cfg.max_entries = 2;
+    bus_id bus;
+    if (HIVE_FAILED(hive_bus_create(&cfg, &bus))) {
+        TEST_FAIL("hive_bus_create");
+        hive_exit();
+    }
+    hive_bus_subscribe(bus);
+
+    // Borrow A, then overrun the 2-entry ring so A's entry is evicted
+    const void *ref = NULL;
+    size_t len = 0;
+    hive_bus_publish(bus, "A", 2);
+    hive_status status = hive_bus_read_ref(bus, &ref, &len);
+    hive_bus_publish(bus, "B", 2);
+    hive_bus_publish(bus, "C", 2);
+    hive_bus_publish(bus, "D", 2);
+    if (HIVE_SUCCEEDED(status) && len == 2 && strcmp(ref, "A") == 0) {
+        TEST_PASS("borrowed entry intact after eviction");
+    } else {
+        TEST_FAIL("borrowed entry changed under the lease");
+    }
+
+    // The next borrow ends the first one and reads on from the cursor
+    status = hive_bus_read_ref(bus, &ref, &len);
+    if (HIVE_SUCCEEDED(status) && strcmp(ref, "C") == 0) {
+        TEST_PASS("next read_ref returns the oldest surviving entry");
+    } else {
+        TEST_FAIL("read_ref after eviction");
+    }
+    hive_bus_release(bus);
+    hive_bus_unsubscribe(bus);
+    hive_bus_destroy(bus);
+
+    // Consumption frees the entry, not the payload still on loan
+    cfg = (hive_bus_config)TEST_BUS_CONFIG;
+    cfg.consume_after_reads = 1;
+    hive_bus_create(&cfg, &bus);
+    hive_bus_subscribe(bus);
+    hive_bus_publish(bus, "E", 2);
+    status = hive_bus_read_ref(bus, &ref, &len);
+    if (HIVE_SUCCEEDED(status) && hive_bus_entry_count(bus) == 0 &&
+        strcmp(ref, "E") == 0) {
+        TEST_PASS("consumed entry stays readable through the lease");
+    } else {
+        TEST_FAIL("consume under lease");
+    }
+    hive_bus_unsubscribe(bus); // Ends the lease
+    hive_bus_destroy(bus);
+
+    // A latest-value publish never writes into a borrowed sample
+    cfg = (hive_bus_config)TEST_BUS_CONFIG;
+    cfg.mode = HIVE_BUS_LATEST;
+    hive_bus_create(&cfg, &bus);
+    hive_bus_subscribe(bus);
+    hive_bus_publish(bus, "old", 4);
+    status = hive_bus_read_ref(bus, &ref, &len);
+    hive_bus_publish(bus, "new", 4);
+    char buf[8];
+    bool fresh = false;
+    hive_status latest =
+        hive_bus_read_latest(bus, buf, sizeof(buf), &len, &fresh);
+    if (HIVE_SUCCEEDED(status) && strcmp(ref, "old") == 0 &&
+        HIVE_SUCCEEDED(latest) && fresh && strcmp(buf, "new") == 0) {
+        TEST_PASS("latest-value publish leaves the borrowed sample alone");
+    } else {
+        TEST_FAIL("latest-value overwrite under lease");
+    }
+    hive_bus_unsubscribe(bus);
+    hive_bus_destroy(bus);
+    hive_exit();
+}
+
+// ============================================================================
+// Test 17: Bus storage comes from the bus arena, not the IPC message pool
+// ============================================================================
+
+static void test17_dedicated_storage(void *args,
+                                     const hive_spawn_info *siblings,
+                                     size_t sibling_count) {
+    (void)args;
+    (void)siblings;
+    (void)sibling_count;
+    printf("\nTest 17: Bus storage is independent of the message pool\n");
+    fflush(stdout);
+
+    hive_bus_config cfg = TEST_BUS_CONFIG;
+    bus_id bus;
+    if (HIVE_FAILED(hive_bus_create(&cfg, &bus))) {
+        TEST_FAIL("hive_bus_create");
+        hive_exit();
+    }
+    hive_bus_subscribe(bus);
+
+    // Fill the IPC pools with messages to self
+    actor_id self = hive_self();
+    int sent = 0;
+    while (HIVE_SUCCEEDED(hive_ipc_notify(self, 0, "x", 2)) &&
+           sent <= HIVE_MESSAGE_DATA_POOL_SIZE) {
+        sent++;
+    }
+
+    int published = 0;
+    for (size_t i = 0; i < 2 * cfg.max_entries; i++) {
+        if (HIVE_SUCCEEDED(hive_bus_publish(bus, &i, sizeof(i)))) {
+            published++;
+        }
+    }
+    size_t last = 0;
+    size_t len;
+    while (HIVE_SUCCEEDED(hive_bus_read(bus, &last, sizeof(last), &len))) {
+    }
+    if (published == (int)(2 * cfg.max_entries) &&
+        last == 2 * cfg.max_entries - 1) {
+        TEST_PASS("publish unaffected by an exhausted IPC message pool");
+    } else {
+        printf("    %d of %zu published after %d IPC sends\n", published,
+               2 * cfg.max_entries, sent);
+        TEST_FAIL("bus publish failed with the message pool full");
+    }
+
+    hive_message msg;
+    while (HIVE_SUCCEEDED(hive_ipc_recv(&msg, 0))) {
+    }
+    hive_bus_unsubscribe(bus);
+    hive_bus_destroy(bus);
+
+    // Large buses fill the arena; destroying one makes room again
+    cfg.max_entries = HIVE_MAX_BUS_ENTRIES;
+    cfg.max_entry_size = HIVE_MAX_MESSAGE_SIZE;
+    bus_id buses[HIVE_MAX_BUSES];
+    size_t created = 0;
+    hive_status status = HIVE_SUCCESS;
+    while (created < HIVE_MAX_BUSES) {
+        status = hive_bus_create(&cfg, &buses[created]);
+        if (HIVE_FAILED(status)) {
+            break;
+        }
+        created++;
+    }
+    if (created > 0 && status.code == HIVE_ERR_NOMEM &&
+        strstr(status.msg, "arena")) {
+        TEST_PASS("bus arena exhaustion returns HIVE_ERR_NOMEM");
+    } else {
+        printf("    created %zu buses, last status %s\n", created,
+               status.msg ? status.msg : "OK");
+        TEST_FAIL("bus arena exhaustion");
+    }
+
+    if (created > 0) {
+        hive_bus_destroy(buses[--created]);
+        status = hive_bus_create(&cfg, &buses[created]);
+        if (HIVE_SUCCEEDED(status)) {
+            TEST_PASS("destroyed bus storage is reused");
+            created++;
+        } else {
+            TEST_FAIL("arena space not returned on destroy");
+        }
+    }
+    while (created > 0) {
+        hive_bus_destroy(buses[--created]);
+    }
+    hive_exit();
+}
+
+// ============================================================================
+// Test 18: Decimating and rate-limited subscriptions
+// ============================================================================
+
+static bus_id s_filter_bus;
+static int s_filter_values[8];
+static int s_filter_count;
+
+static void decimated_subscriber(void *args, const hive_spawn_info *siblings,
+                                 size_t sibling_count) {
+    (void)args;
+    (void)siblings;
+    (void)sibling_count;
+    hive_bus_sub_opts opts = HIVE_BUS_SUB_OPTS_DEFAULT;
+    opts.decimation = 4;
+    if (HIVE_FAILED(hive_bus_subscribe_ex(s_filter_bus, &opts))) {
+        hive_exit();
+    }
+
+    // One wakeup per delivered entry: rejected entries must not wake us
+    int value;
+    size_t len;
+    while (s_filter_count < 8 &&
+           HIVE_SUCCEEDED(hive_bus_read_wait(s_filter_bus, &value,
+                                             sizeof(value), &len, 200))) {
+        s_filter_values[s_filter_count++] = value;
+    }
+    hive_bus_unsubscribe(s_filter_bus);
+    hive_exit();
+}
+
+static void test18_filtered_subscriptions(void *args,
+                                          const hive_spawn_info *siblings,
+                                          size_t sibling_count) {
+    (void)args;
+    (void)siblings;
+    (void)sibling_count;
+    printf("\nTest 18: Decimating and rate-limited subscriptions\n");
+    fflush(stdout);
+
+    hive_bus_config cfg = TEST_BUS_CONFIG;
+    if (HIVE_FAILED(hive_bus_create(&cfg, &s_filter_bus))) {
+        TEST_FAIL("hive_bus_create");
+        hive_exit();
+    }
+
+    // Every 4th entry, each publish given the chance to wake the reader
+    s_filter_count = 0;
+    actor_config acfg = HIVE_ACTOR_CONFIG_DEFAULT;
+    acfg.stack_size = TEST_STACK_SIZE(16 * 1024);
+    actor_id reader;
+    hive_spawn(decimated_subscriber, NULL, NULL, &acfg, &reader);
+    hive_sleep(10000);
+    for (int i = 0; i < 16; i++) {
+        hive_bus_publish(s_filter_bus, &i, sizeof(i));
+        hive_yield();
+    }
+    hive_sleep(300000); // Reader times out and leaves
+
+    if (s_filter_count == 4 && s_filter_values[0] == 0 &&
+        s_filter_values[1] == 4 && s_filter_values[2] == 8 &&
+        s_filter_values[3] == 12) {
+        TEST_PASS("decimation 4 delivers entries 0, 4, 8, 12 only");
+    } else {
+        printf("    %d delivered\n", s_filter_count);
+        TEST_FAIL("decimated delivery");
+    }
+
+    // At most one entry per 50 ms, newest first
+    hive_bus_sub_opts opts = HIVE_BUS_SUB_OPTS_DEFAULT;
+    opts.min_interval_us = 50000;
+    hive_bus_subscribe_ex(s_filter_bus, &opts);
+    for (int i = 100; i < 103; i++) {
+        hive_bus_publish(s_filter_bus, &i, sizeof(i));
+    }
+    int value = 0;
+    size_t len;
+    uint64_t missed = 1;
+    hive_status status =
+        hive_bus_read(s_filter_bus, &value, sizeof(value), &len);
+    hive_bus_missed(s_filter_bus, &missed);
+    if (HIVE_SUCCEEDED(status) && value == 102 && missed == 0) {
+        TEST_PASS("rate limit delivers the newest entry, skips are not missed");
+    } else {
+        printf("    value %d, missed %lu\n", value, (unsigned long)missed);
+        TEST_FAIL("rate-limited read");
+    }
+
+    int next = 103;
+    hive_bus_publish(s_filter_bus, &next, sizeof(next));
+    status = hive_bus_read(s_filter_bus, &value, sizeof(value), &len);
+    if (status.code == HIVE_ERR_WOULDBLOCK) {
+        TEST_PASS("no delivery within the interval");
+    } else {
+        TEST_FAIL("read within the interval returned data");
+    }
+
+    hive_sleep(60000);
+    status = hive_bus_read(s_filter_bus, &value, sizeof(value), &len);
+    if (HIVE_SUCCEEDED(status) && value == 103) {
+        TEST_PASS("entry held back is delivered once the interval passes");
+    } else {
+        TEST_FAIL("delivery after the interval");
+    }
+
+    hive_bus_unsubscribe(s_filter_bus);
+    hive_bus_destroy(s_filter_bus);
+    hive_exit();
+}
+
+// ============================================================================
+// Test 19: Content-filtered subscriptions
+// ============================================================================
+
+typedef struct {
+    uint32_t id;
+    float current;
+} motor_sample;
+
+static bus_id s_alarm_bus;
+static int s_alarm_calls;
+static int s_alarm_delivered;
+static uint32_t s_alarm_last_id;
+
+static bool alarm_filter(const void *data, size_t len, void *ctx) {
+    (void)ctx;
+    s_alarm_calls++;
+    const motor_sample *m = data;
+    return len == sizeof(*m) && m->current > 2.0f;
+}
+
+static void alarm_subscriber(void *args, const hive_spawn_info *siblings,
+                             size_t sibling_count) {
+    (void)siblings;
+    (void)sibling_count;
+    hive_bus_sub_opts opts = HIVE_BUS_SUB_OPTS_DEFAULT;
+    if (args) {
+        opts.filter = alarm_filter;
+    } else {
+        opts.field.op = HIVE_BUS_CMP_GT;
+        opts.field.type = HIVE_BUS_FIELD_F32;
+        opts.field.offset = offsetof(motor_sample, current);
+        opts.field.value.f32 = 2.0f;
+    }
+    if (HIVE_FAILED(hive_bus_subscribe_ex(s_alarm_bus, &opts))) {
+        hive_exit();
+    }
+
+    motor_sample m;
+    size_t len;
+    while (HIVE_SUCCEEDED(
+        hive_bus_read_wait(s_alarm_bus, &m, sizeof(m), &len, 200))) {
+        s_alarm_delivered++;
+        s_alarm_last_id = m.id;
+    }
+    hive_bus_unsubscribe(s_alarm_bus);
+    hive_exit();
+}
+
+static void test19_content_filter(void *args, const hive_spawn_info *siblings,
+                                  size_t sibling_count) {
+    (void)args;
+    (void)siblings;
+    (void)sibling_count;
+    printf("\nTest 19: Content-filtered subscriptions\n");
+    fflush(stdout);
+
+    hive_bus_config cfg = TEST_BUS_CONFIG;
+    if (HIVE_FAILED(hive_bus_create(&cfg, &s_alarm_bus))) {
+        TEST_FAIL("hive_bus_create");
+        hive_exit();
+    }
+
+    actor_config acfg = HIVE_ACTOR_CONFIG_DEFAULT;
+    acfg.stack_size = TEST_STACK_SIZE(16 * 1024);
+    static int use_callback = 1;
+    for (int pass = 0; pass < 2; pass++) {
+        s_alarm_calls = 0;
+        s_alarm_delivered = 0;
+        s_alarm_last_id = 0;
+        actor_id watcher;
+        hive_spawn(alarm_subscriber, NULL, pass == 0 ? &use_callback : NULL,
+                   &acfg, &watcher);
+        hive_sleep(10000);
+
+        // Only sample 7 is over the threshold
+        for (uint32_t i = 0; i < 10; i++) {
+            motor_sample m = {.id = i, .current = i == 7 ? 3.5f : 0.5f};
+            hive_bus_publish(s_alarm_bus, &m, sizeof(m));
+            hive_yield();
+        }
+        hive_sleep(300000); // Watcher times out and leaves
+
+        const char *what = pass == 0 ? "callback" : "field compare";
+        if (s_alarm_delivered == 1 && s_alarm_last_id == 7) {
+            printf("    %s: delivered sample %u only\n", what,
+                   (unsigned)s_alarm_last_id);
+            TEST_PASS("content filter delivers matching entries only");
+        } else {
+            printf("    %s: %d delivered\n", what, s_alarm_delivered);
+            TEST_FAIL("content filter delivery");
+        }
+        if (pass == 0) {
+            if (s_alarm_calls == 10) {
+                TEST_PASS("callback evaluated once per entry");
+            } else {
+                printf("    %d calls for 10 entries\n", s_alarm_calls);
+                TEST_FAIL("callback call count");
+            }
+        }
+    }
+
+    // Entries too short for the field never match
+    hive_bus_sub_opts opts = HIVE_BUS_SUB_OPTS_DEFAULT;
+    opts.field.op = HIVE_BUS_CMP_EQ;
+    opts.field.type = HIVE_BUS_FIELD_U32;
+    opts.field.offset = 4;
+    opts.field.value.u32 = 0;
+    hive_bus_subscribe_ex(s_alarm_bus, &opts);
+    uint32_t word[2] = {0, 0};
+    hive_bus_publish(s_alarm_bus, word, sizeof(uint32_t));
+    hive_bus_publish(s_alarm_bus, word, sizeof(word));
+    size_t len;
+    uint64_t missed = 1;
+    hive_status status = hive_bus_read(s_alarm_bus, word, sizeof(word), &len);
+    hive_status again = hive_bus_read(s_alarm_bus, word, sizeof(word), &len);
+    hive_bus_missed(s_alarm_bus, &missed);
+    if (HIVE_SUCCEEDED(status) && len == sizeof(word) && missed == 0 &&
+        again.code == HIVE_ERR_WOULDBLOCK) {
+        TEST_PASS("short entry rejected, not counted as missed");
+    } else {
+        TEST_FAIL("field filter on short entry");
+    }
+
+    hive_bus_unsubscribe(s_alarm_bus);
+    hive_bus_destroy(s_alarm_bus);
+    hive_exit();
+}
+
+// ============================================================================
+// Test 20: Lossless bus with publisher back-pressure
+// ============================================================================
+
+#define LOSSLESS_COUNT 50
+
+static bus_id s_lossless_bus;
+static int s_lossless_published;
+
+static void lossless_producer(void *args, const hive_spawn_info *siblings,
+                              size_t sibling_count) {
+    (void)siblings;
+    (void)sibling_count;
+    int count = *(int *)args;
+    for (int i = 0; i < count; i++) {
+        if (HIVE_FAILED(hive_bus_publish_wait(s_lossless_bus, &i, sizeof(i),
+                                              -1))) {
+            break;
+        }
+        s_lossless_published++;
+    }
+    hive_exit();
+}
+
+static void test20_lossless(void *args, const hive_spawn_info *siblings,
+                            size_t sibling_count) {
+    (void)args;
+    (void)siblings;
+    (void)sibling_count;
+    printf("\nTest 20: Lossless bus with publisher back-pressure\n");
+    fflush(stdout);
+
+    hive_bus_config cfg = TEST_BUS_CONFIG;
+    cfg.max_entries = 4;
+    cfg.max_age_ms = 100;
+    cfg.overflow = HIVE_BUS_OVERFLOW_BLOCK;
+    hive_status status = hive_bus_create(&cfg, &s_lossless_bus);
+    if (status.code == HIVE_ERR_INVALID) {
+        TEST_PASS("lossless bus with expiry rejected");
+    } else {
+        TEST_FAIL("lossless bus accepted max_age_ms");
+    }
+    cfg.max_age_ms = 0;
+    if (HIVE_FAILED(hive_bus_create(&cfg, &s_lossless_bus))) {
+        TEST_FAIL("hive_bus_create");
+        hive_exit();
+    }
+    hive_bus_subscribe(s_lossless_bus);
+
+    // Full: publish refuses instead of evicting the unread oldest entry
+    int value = 0;
+    for (int i = 0; i < 4; i++) {
+        hive_bus_publish(s_lossless_bus, &i, sizeof(i));
+    }
+    status = hive_bus_publish(s_lossless_bus, &value, sizeof(value));
+    hive_status timed =
+        hive_bus_publish_wait(s_lossless_bus, &value, sizeof(value), 20);
+    size_t len;
+    hive_bus_read(s_lossless_bus, &value, sizeof(value), &len);
+    if (status.code == HIVE_ERR_WOULDBLOCK &&
+        timed.code == HIVE_ERR_TIMEOUT && value == 0 &&
+        hive_bus_entry_count(s_lossless_bus) == 3) {
+        TEST_PASS("full bus refuses publish, read frees the oldest entry");
+    } else {
+        TEST_FAIL("full lossless bus");
+    }
+    while (HIVE_SUCCEEDED(
+        hive_bus_read(s_lossless_bus, &value, sizeof(value), &len))) {
+    }
+
+    // A producer far ahead of the reader waits instead of overrunning it
+    actor_config acfg = HIVE_ACTOR_CONFIG_DEFAULT;
+    acfg.stack_size = TEST_STACK_SIZE(16 * 1024);
+    static int count = LOSSLESS_COUNT;
+    s_lossless_published = 0;
+    actor_id producer;
+    hive_spawn(lossless_producer, NULL, &count, &acfg, &producer);
+
+    int received = 0;
+    bool in_order = true;
+    size_t max_count = 0;
+    while (received < LOSSLESS_COUNT &&
+           HIVE_SUCCEEDED(hive_bus_read_wait(s_lossless_bus, &value,
+                                             sizeof(value), &len, 200))) {
+        in_order = in_order && value == received;
+        received++;
+        size_t n = hive_bus_entry_count(s_lossless_bus);
+        max_count = n > max_count ? n : max_count;
+        hive_yield(); // Let the producer refill the ring
+    }
+    uint64_t missed = 1;
+    hive_bus_missed(s_lossless_bus, &missed);
+    if (received == LOSSLESS_COUNT && in_order && missed == 0 &&
+        s_lossless_published == LOSSLESS_COUNT && max_count == 3) {
+        printf("    %d entries through a 4-entry ring, none missed\n",
+               received);
+        TEST_PASS("blocked publisher resumes as the reader drains");
+    } else {
+        printf("    received %d, published %d, missed %lu, in order %d\n",
+               received, s_lossless_published, (unsigned long)missed,
+               in_order);
+        TEST_FAIL("lossless delivery");
+    }
+
+    // Killing a publisher while it waits leaves the bus usable
+    count = 10;
+    s_lossless_published = 0;
+    hive_spawn(lossless_producer, NULL, &count, &acfg, &producer);
+    hive_sleep(10000);
+    hive_kill(producer);
+    int drained = 0;
+    while (HIVE_SUCCEEDED(
+        hive_bus_read(s_lossless_bus, &value, sizeof(value), &len))) {
+        drained++;
+    }
+    if (s_lossless_published == 4 && drained == 4 &&
+        HIVE_SUCCEEDED(
+            hive_bus_publish(s_lossless_bus, &value, sizeof(value)))) {
+        TEST_PASS("killed waiting publisher cleaned up");
+    } else {
+        printf("    published %d, drained %d\n", s_lossless_published,
+               drained);
+        TEST_FAIL("killed waiting publisher");
+    }
+
+    // Nobody subscribed: entries are dropped, publish never blocks
+    hive_bus_unsubscribe(s_lossless_bus);
+    bool never_full = true;
+    for (int i = 0; i < 8; i++) {
+        never_full = never_full && HIVE_SUCCEEDED(hive_bus_publish(
+                                       s_lossless_bus, &i, sizeof(i)));
+    }
+    if (never_full && hive_bus_entry_count(s_lossless_bus) == 0) {
+        TEST_PASS("entries without subscribers are dropped");
+    } else {
+        TEST_FAIL("lossless bus without subscribers");
+    }
+
+    hive_bus_destroy(s_lossless_bus);
+    hive_exit();
+}
+
+// ============================================================================
+// Test 21: Batch publish and batch read
+// ============================================================================
+
+static bus_id s_batch_bus;
+static int s_batch_values[8];
+static int s_batch_received;
+
+static void batch_reader(void *args, const hive_spawn_info *siblings,
+                         size_t sibling_count) {
+    (void)args;
+    (void)siblings;
+    (void)sibling_count;
+    hive_bus_subscribe(s_batch_bus);
+
+    // Woken once for the whole batch, then drain the rest in one call
+    int first;
+    size_t len;
+    size_t lens[8];
+    size_t n = 0;
+    hive_status status =
+        hive_bus_read_wait(s_batch_bus, &first, sizeof(first), &len, 500);
+    if (HIVE_SUCCEEDED(status)) {
+        s_batch_values[s_batch_received++] = first;
+        hive_bus_read_batch(s_batch_bus, &s_batch_values[1], sizeof(int), 7,
+                            lens, &n);
+        s_batch_received += (int)n;
+    }
+    hive_bus_unsubscribe(s_batch_bus);
+    hive_exit();
+}
+
+static void test21_batch(void *args, const hive_spawn_info *siblings,
+                         size_t sibling_count) {
+    (void)args;
+    (void)siblings;
+    (void)sibling_count;
+    printf("\nTest 21: Batch publish and batch read\n");
+    fflush(stdout);
+
+    hive_bus_config cfg = TEST_BUS_CONFIG;
+    cfg.max_entries = 4;
+    if (HIVE_FAILED(hive_bus_create(&cfg, &s_batch_bus))) {
+        TEST_FAIL("hive_bus_create");
+        hive_exit();
+    }
+    hive_bus_subscribe(s_batch_bus);
+
+    // Entries of different lengths from a fixed-stride array
+    uint32_t src[3][2] = {{10, 11}, {20, 21}, {30, 31}};
+    size_t src_lens[3] = {8, 4, 8};
+    size_t published = 0;
+    hive_status status = hive_bus_publish_batch(
+        s_batch_bus, src, sizeof(src[0]), src_lens, 3, &published);
+    uint32_t dst[4][2] = {{0}};
+    size_t lens[4] = {0};
+    size_t n = 0;
+    hive_status first = hive_bus_read_batch(s_batch_bus, dst, sizeof(dst[0]), 2,
+                                            lens, &n);
+    size_t n_first = n;
+    hive_status second = hive_bus_read_batch(s_batch_bus, dst[2],
+                                             sizeof(dst[0]), 2, &lens[2], &n);
+    if (HIVE_SUCCEEDED(status) && published == 3 && HIVE_SUCCEEDED(first) &&
+        n_first == 2 && HIVE_SUCCEEDED(second) && n == 1 && lens[0] == 8 &&
+        lens[1] == 4 && lens[2] == 8 && dst[0][1] == 11 && dst[1][0] == 20 &&
+        dst[2][0] == 30 && dst[2][1] == 31) {
+        TEST_PASS("batch round trip keeps order and lengths");
+    } else {
+        TEST_FAIL("batch round trip");
+    }
+    status = hive_bus_read_batch(s_batch_bus, dst, sizeof(dst[0]), 4, lens, &n);
+    if (status.code == HIVE_ERR_WOULDBLOCK && n == 0) {
+        TEST_PASS("batch read of an empty bus returns WOULDBLOCK");
+    } else {
+        TEST_FAIL("empty batch read");
+    }
+
+    // Larger than the ring: the oldest entries are evicted and missed
+    uint32_t many[6][2] = {{0}};
+    size_t many_lens[6];
+    for (int i = 0; i < 6; i++) {
+        many[i][0] = (uint32_t)i;
+        many_lens[i] = sizeof(many[0]);
+    }
+    hive_bus_publish_batch(s_batch_bus, many, sizeof(many[0]), many_lens, 6,
+                           NULL);
+    uint32_t narrow[4];
+    status = hive_bus_read_batch(s_batch_bus, narrow, sizeof(narrow[0]), 4,
+                                 lens, &n);
+    uint64_t missed = 0;
+    hive_bus_missed(s_batch_bus, &missed);
+    if (status.code == HIVE_ERR_TRUNCATED && n == 4 && lens[0] == 4 &&
+        narrow[0] == 2 && narrow[3] == 5 && missed == 2) {
+        TEST_PASS("oversized batch evicts, narrow stride truncates");
+    } else {
+        printf("    n %zu, first %u, missed %lu\n", n, (unsigned)narrow[0],
+               (unsigned long)missed);
+        TEST_FAIL("oversized batch");
+    }
+
+    // One bad length rejects the whole batch
+    many_lens[3] = cfg.max_entry_size + 1;
+    status = hive_bus_publish_batch(s_batch_bus, many, sizeof(many[0]),
+                                    many_lens, 6, &published);
+    if (status.code == HIVE_ERR_INVALID && published == 0 &&
+        hive_bus_read(s_batch_bus, narrow, sizeof(narrow), &n).code ==
+            HIVE_ERR_WOULDBLOCK) {
+        TEST_PASS("invalid length rejects the whole batch");
+    } else {
+        TEST_FAIL("invalid batch");
+    }
+    hive_bus_unsubscribe(s_batch_bus);
+
+    // A blocked reader is woken by the batch and drains it
+    actor_config acfg = HIVE_ACTOR_CONFIG_DEFAULT;
+    acfg.stack_size = TEST_STACK_SIZE(16 * 1024);
+    s_batch_received = 0;
+    actor_id reader;
+    hive_spawn(batch_reader, NULL, NULL, &acfg, &reader);
+    hive_sleep(10000);
+    int values[4] = {1, 2, 3, 4};
+    size_t value_lens[4] = {sizeof(int), sizeof(int), sizeof(int),
+                            sizeof(int)};
+    hive_bus_publish_batch(s_batch_bus, values, sizeof(int), value_lens, 4,
+                           NULL);
+    hive_sleep(10000);
+    if (s_batch_received == 4 && s_batch_values[0] == 1 &&
+        s_batch_values[3] == 4) {
+        TEST_PASS("blocked reader woken by batch, drains the rest");
+    } else {
+        printf("    received %d\n", s_batch_received);
+        TEST_FAIL("batch wakeup");
+    }
+    hive_bus_destroy(s_batch_bus);
+
+    // Lossless bus: the batch stops when the ring is full
+    cfg.overflow = HIVE_BUS_OVERFLOW_BLOCK;
+    hive_bus_create(&cfg, &s_batch_bus);
+    hive_bus_subscribe(s_batch_bus);
+    status = hive_bus_publish_batch(s_batch_bus, many, sizeof(many[0]),
+                                    src_lens, 3, NULL);
+    status = hive_bus_publish_batch(s_batch_bus, many, sizeof(many[0]),
+                                    src_lens, 3, &published);
+    if (status.code == HIVE_ERR_WOULDBLOCK && published == 1 &&
+        hive_bus_entry_count(s_batch_bus) == 4) {
+        TEST_PASS("lossless batch stops when full");
+    } else {
+        TEST_FAIL("lossless batch");
+    }
+    hive_bus_unsubscribe(s_batch_bus);
+    hive_bus_destroy(s_batch_bus);
+    hive_exit();
+}
+
+// ============================================================================
+// Test 22: Rate-limited reader wakes when its interval ends
+// ============================================================================
+
+static bus_id s_held_bus;
+static int s_held_value;
+static uint64_t s_held_wait_us;
+
+static void held_reader(void *args, const hive_spawn_info *siblings,
+                        size_t sibling_count) {
+    (void)args;
+    (void)siblings;
+    (void)sibling_count;
+    hive_bus_sub_opts opts = HIVE_BUS_SUB_OPTS_DEFAULT;
+    opts.min_interval_us = 100000;
+    hive_bus_subscribe_ex(s_held_bus, &opts);
+
+    // The first entry starts the interval; the second arrives inside it and
+    // nothing is published after that
+    int value;
+    size_t len;
+    hive_bus_read_wait(s_held_bus, &value, sizeof(value), &len, -1);
+    uint64_t start = hive_get_time();
+    if (HIVE_SUCCEEDED(
+            hive_bus_read_wait(s_held_bus, &value, sizeof(value), &len, -1))) {
+        s_held_value = value;
+        s_held_wait_us = hive_get_time() - start;
+    }
+    hive_bus_unsubscribe(s_held_bus);
+    hive_exit();
+}
+
+static void test22_rate_limit_wakeup(void *args,
+                                     const hive_spawn_info *siblings,
+                                     size_t sibling_count) {
+    (void)args;
+    (void)siblings;
+    (void)sibling_count;
+    printf("\nTest 22: Rate-limited reader wakes when its interval ends\n");
+    fflush(stdout);
+
+    hive_bus_config cfg = TEST_BUS_CONFIG;
+    if (HIVE_FAILED(hive_bus_create(&cfg, &s_held_bus))) {
+        TEST_FAIL("hive_bus_create");
+        hive_exit();
+    }
+
+    actor_config acfg = HIVE_ACTOR_CONFIG_DEFAULT;
+    acfg.stack_size = TEST_STACK_SIZE(16 * 1024);
+    s_held_value = 0;
+    s_held_wait_us = 0;
+    actor_id reader;
+    hive_spawn(held_reader, NULL, NULL, &acfg, &reader);
+    hive_sleep(10000);
+    int value = 1;
+    hive_bus_publish(s_held_bus, &value, sizeof(value));
+    hive_sleep(10000);
+    value = 2;
+    hive_bus_publish(s_held_bus, &value, sizeof(value));
+    hive_sleep(300000); // Publisher quiet well past the interval
+
+    if (s_held_value == 2 && s_held_wait_us < 200000) {
+        printf("    newest entry after %lu us\n",
+               (unsigned long)s_held_wait_us);
+        TEST_PASS("blocked reader gets the held entry after the interval");
+    } else {
+        printf("    value %d after %lu us\n", s_held_value,
+               (unsigned long)s_held_wait_us);
+        TEST_FAIL("rate-limited reader not woken");
+        hive_kill(reader);
+    }
+    hive_bus_destroy(s_held_bus);
+    hive_exit();
+}
+
 // ============================================================================
 // Test runner
 // ============================================================================
@@ -777,6 +1877,16 @@ static void (*test_funcs[])(void *, const hive_spawn_info *, size_t) = {
     test10_entry_count,
     test11_subscribe_destroyed_bus,
     test12_buffer_overflow_protection,
+    test13_overrun_missed,
+    test14_blocked_fanout,
+    test15_latest_value,
+    test16_read_ref,
+    test17_dedicated_storage,
+    test18_filtered_subscriptions,
+    test19_content_filter,
+    test20_lossless,
+    test21_batch,
+    test22_rate_limit_wakeup,
 };
 
 #define NUM_TESTS (sizeof(test_funcs) / sizeof(test_funcs[0]))
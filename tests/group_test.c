@@ -0,0 +1,361 @@
+#include "hive_runtime.h"
+#include "hive_ipc.h"
+#include "hive_group.h"
+#include "hive_link.h"
+#include "hive_static_config.h"
+#include <stdio.h>
+#include <string.h>
+
+/* TEST_STACK_SIZE caps stack for QEMU builds; passes through on native */
+#ifndef TEST_STACK_SIZE
+#define TEST_STACK_SIZE(x) (x)
+#endif
+
+// Test results
+static int tests_passed = 0;
+static int tests_failed = 0;
+
+#define TEST_PASS(name)               \
+    do {                              \
+        printf("  PASS: %s\n", name); \
+        fflush(stdout);               \
+        tests_passed++;               \
+    } while (0)
+#define TEST_FAIL(name)               \
+    do {                              \
+        printf("  FAIL: %s\n", name); \
+        fflush(stdout);               \
+        tests_failed++;               \
+    } while (0)
+
+#define TAG_JOINED 1
+#define TAG_REPORT 2
+#define TAG_DATA 3
+#define TAG_QUIT 4
+
+// Group member used by several tests: joins, acks, reports one multicast
+typedef struct {
+    group_id group;
+    actor_id parent;
+} member_args;
+
+typedef struct {
+    const void *data; // Payload pointer as seen by the receiver
+    int value;
+} member_report;
+
+static void member_actor(void *args, const hive_spawn_info *siblings,
+                         size_t sibling_count) {
+    (void)siblings;
+    (void)sibling_count;
+    member_args *a = args;
+
+    hive_group_join(a->group);
+    hive_ipc_notify(a->parent, TAG_JOINED, NULL, 0);
+
+    hive_message msg;
+    while (HIVE_SUCCEEDED(hive_ipc_recv(&msg, 1000))) {
+        if (msg.tag == TAG_QUIT) {
+            break;
+        }
+        if (msg.tag == TAG_DATA) {
+            member_report report = {msg.data, *(const int *)msg.data};
+            hive_ipc_notify(a->parent, TAG_REPORT, &report, sizeof(report));
+        }
+    }
+
+    hive_exit();
+}
+
+static int wait_joined(int count) {
+    int joined = 0;
+    hive_message msg;
+    while (joined < count &&
+           HIVE_SUCCEEDED(hive_ipc_recv_match(HIVE_SENDER_ANY, HIVE_MSG_NOTIFY,
+                                              TAG_JOINED, &msg, 1000))) {
+        joined++;
+    }
+    return joined;
+}
+
+// ============================================================================
+// Test 1: Create and destroy groups
+// ============================================================================
+
+static void test1_create_destroy(void *args, const hive_spawn_info *siblings,
+                                 size_t sibling_count) {
+    (void)args;
+    (void)siblings;
+    (void)sibling_count;
+    printf("\nTest 1: Create and destroy groups\n");
+
+    group_id g;
+    if (HIVE_SUCCEEDED(hive_group_create(&g)) && g != GROUP_ID_INVALID) {
+        TEST_PASS("hive_group_create returns valid id");
+    } else {
+        TEST_FAIL("hive_group_create failed");
+        hive_exit();
+    }
+
+    if (hive_group_count(g) == 0) {
+        TEST_PASS("new group is empty");
+    } else {
+        TEST_FAIL("new group should be empty");
+    }
+
+    if (HIVE_SUCCEEDED(hive_group_destroy(g)) &&
+        hive_group_destroy(g).code == HIVE_ERR_INVALID) {
+        TEST_PASS("destroy succeeds once, then group is gone");
+    } else {
+        TEST_FAIL("destroy semantics");
+    }
+
+    if (hive_group_create(NULL).code == HIVE_ERR_INVALID &&
+        hive_group_join(GROUP_ID_INVALID).code == HIVE_ERR_INVALID) {
+        TEST_PASS("invalid arguments rejected");
+    } else {
+        TEST_FAIL("invalid arguments should be rejected");
+    }
+
+    hive_exit();
+}
+
+// ============================================================================
+// Test 2: Join and leave
+// ============================================================================
+
+static void test2_join_leave(void *args, const hive_spawn_info *siblings,
+                             size_t sibling_count) {
+    (void)args;
+    (void)siblings;
+    (void)sibling_count;
+    printf("\nTest 2: Join and leave\n");
+
+    group_id g;
+    hive_group_create(&g);
+
+    if (HIVE_SUCCEEDED(hive_group_join(g)) && hive_group_count(g) == 1) {
+        TEST_PASS("join adds member");
+    } else {
+        TEST_FAIL("join failed");
+    }
+
+    if (hive_group_join(g).code == HIVE_ERR_EXISTS) {
+        TEST_PASS("double join returns HIVE_ERR_EXISTS");
+    } else {
+        TEST_FAIL("double join should fail");
+    }
+
+    if (HIVE_SUCCEEDED(hive_group_leave(g)) && hive_group_count(g) == 0) {
+        TEST_PASS("leave removes member");
+    } else {
+        TEST_FAIL("leave failed");
+    }
+
+    if (hive_group_leave(g).code == HIVE_ERR_INVALID) {
+        TEST_PASS("leave when not a member rejected");
+    } else {
+        TEST_FAIL("leave when not a member should fail");
+    }
+
+    hive_group_destroy(g);
+    hive_exit();
+}
+
+// ============================================================================
+// Test 3: Multicast delivers one shared payload to every member
+// ============================================================================
+
+#define TEST3_MEMBERS 4
+
+static void test3_multicast(void *args, const hive_spawn_info *siblings,
+                            size_t sibling_count) {
+    (void)args;
+    (void)siblings;
+    (void)sibling_count;
+    printf("\nTest 3: Multicast delivers one shared payload to every member\n");
+
+    group_id g;
+    hive_group_create(&g);
+
+    member_args margs = {g, hive_self()};
+    actor_id members[TEST3_MEMBERS];
+    for (int i = 0; i < TEST3_MEMBERS; i++) {
+        hive_spawn(member_actor, NULL, &margs, NULL, &members[i]);
+    }
+    wait_joined(TEST3_MEMBERS);
+
+    int value = 4242;
+    hive_status status = hive_ipc_multicast(g, TAG_DATA, &value, sizeof(value));
+    if (HIVE_FAILED(status)) {
+        printf("    multicast failed: %s\n", status.msg ? status.msg : "?");
+        TEST_FAIL("hive_ipc_multicast failed");
+        hive_exit();
+    }
+
+    int ok = 0;
+    bool shared = true;
+    const void *first = NULL;
+    for (int i = 0; i < TEST3_MEMBERS; i++) {
+        hive_message msg;
+        if (HIVE_FAILED(hive_ipc_recv_match(HIVE_SENDER_ANY, HIVE_MSG_NOTIFY,
+                                            TAG_REPORT, &msg, 1000))) {
+            break;
+        }
+        const member_report *report = msg.data;
+        if (report->value == value) {
+            ok++;
+        }
+        if (first && report->data != first) {
+            shared = false;
+        }
+        first = report->data;
+    }
+
+    if (ok == TEST3_MEMBERS) {
+        TEST_PASS("every member received the multicast");
+    } else {
+        printf("    %d/%d members received it\n", ok, TEST3_MEMBERS);
+        TEST_FAIL("multicast not delivered to all members");
+    }
+
+    if (shared) {
+        TEST_PASS("members share a single payload buffer");
+    } else {
+        TEST_FAIL("payload was copied per member");
+    }
+
+    for (int i = 0; i < TEST3_MEMBERS; i++) {
+        hive_ipc_notify(members[i], TAG_QUIT, NULL, 0);
+    }
+    hive_group_destroy(g);
+    hive_exit();
+}
+
+// ============================================================================
+// Test 4: Dead actors are removed from groups
+// ============================================================================
+
+static void test4_cleanup_on_death(void *args, const hive_spawn_info *siblings,
+                                   size_t sibling_count) {
+    (void)args;
+    (void)siblings;
+    (void)sibling_count;
+    printf("\nTest 4: Dead actors are removed from groups\n");
+
+    group_id g;
+    hive_group_create(&g);
+
+    member_args margs = {g, hive_self()};
+    actor_id member;
+    hive_spawn(member_actor, NULL, &margs, NULL, &member);
+    wait_joined(1);
+
+    if (hive_group_count(g) != 1) {
+        TEST_FAIL("member did not join");
+        hive_exit();
+    }
+
+    uint32_t mon;
+    hive_monitor(member, &mon);
+    hive_ipc_notify(member, TAG_QUIT, NULL, 0);
+    hive_message msg;
+    hive_ipc_recv_match(member, HIVE_MSG_EXIT, HIVE_TAG_ANY, &msg, 1000);
+
+    if (hive_group_count(g) == 0) {
+        TEST_PASS("membership removed when actor exits");
+    } else {
+        TEST_FAIL("dead actor still in group");
+    }
+
+    int value = 1;
+    if (HIVE_SUCCEEDED(hive_ipc_multicast(g, TAG_DATA, &value, sizeof(value)))) {
+        TEST_PASS("multicast to empty group succeeds");
+    } else {
+        TEST_FAIL("multicast to empty group should succeed");
+    }
+
+    hive_group_destroy(g);
+    hive_exit();
+}
+
+// ============================================================================
+// Test runner
+// ============================================================================
+
+static void (*test_funcs[])(void *, const hive_spawn_info *, size_t) = {
+    test1_create_destroy,
+    test2_join_leave,
+    test3_multicast,
+    test4_cleanup_on_death,
+};
+
+#define NUM_TESTS (sizeof(test_funcs) / sizeof(test_funcs[0]))
+
+static void run_all_tests(void *args, const hive_spawn_info *siblings,
+                          size_t sibling_count) {
+    (void)args;
+    (void)siblings;
+    (void)sibling_count;
+
+    for (size_t i = 0; i < NUM_TESTS; i++) {
+        actor_config cfg = HIVE_ACTOR_CONFIG_DEFAULT;
+        cfg.stack_size = TEST_STACK_SIZE(64 * 1024);
+
+        actor_id test;
+        if (HIVE_FAILED(hive_spawn(test_funcs[i], NULL, NULL, &cfg, &test))) {
+            printf("Failed to spawn test %zu\n", i);
+            continue;
+        }
+
+        hive_link(test);
+
+        hive_message msg;
+        hive_ipc_recv(&msg, 10000);
+    }
+
+    hive_exit();
+}
+
+int main(void) {
+    printf("=== Process Group (hive_group) Test Suite ===\n");
+
+    // Group calls before hive_init() must not touch the unset pools
+    printf("\nBefore init: group calls are rejected\n");
+    group_id early;
+    if (hive_group_create(&early).code == HIVE_ERR_INVALID &&
+        hive_group_destroy(1).code == HIVE_ERR_INVALID &&
+        hive_group_count(1) == 0) {
+        TEST_PASS("create, destroy and count rejected before init");
+    } else {
+        TEST_FAIL("group call accepted before init");
+    }
+
+    hive_status status = hive_init();
+    if (HIVE_FAILED(status)) {
+        fprintf(stderr, "Failed to initialize runtime: %s\n",
+                status.msg ? status.msg : "unknown error");
+        return 1;
+    }
+
+    actor_config cfg = HIVE_ACTOR_CONFIG_DEFAULT;
+    cfg.stack_size = TEST_STACK_SIZE(128 * 1024);
+
+    actor_id runner;
+    if (HIVE_FAILED(hive_spawn(run_all_tests, NULL, NULL, &cfg, &runner))) {
+        fprintf(stderr, "Failed to spawn test runner\n");
+        hive_cleanup();
+        return 1;
+    }
+
+    hive_run();
+    hive_cleanup();
+
+    printf("\n=== Results ===\n");
+    printf("Passed: %d\n", tests_passed);
+    printf("Failed: %d\n", tests_failed);
+    printf("\n%s\n",
+           tests_failed == 0 ? "All tests passed!" : "Some tests FAILED!");
+
+    return tests_failed > 0 ? 1 : 0;
+}
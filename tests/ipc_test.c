@@ -1088,6 +1088,562 @@ static void test22_multi_filter_nonblocking(void *args,
     hive_exit();
 }
 
+// ============================================================================
+// Test 23: Retained message survives subsequent receives
+// ============================================================================
+
+static void test23_msg_retain(void *args, const hive_spawn_info *siblings,
+                              size_t sibling_count) {
+    (void)args;
+    (void)siblings;
+    (void)sibling_count;
+    printf("\nTest 23: Retained message survives subsequent receives\n");
+
+    actor_id self = hive_self();
+    hive_ipc_notify(self, 1, "first", 6);
+    hive_ipc_notify(self, 2, "second", 7);
+
+    hive_message first;
+    hive_ipc_recv(&first, 0);
+    hive_status status = hive_msg_retain(&first);
+    if (HIVE_FAILED(status)) {
+        printf("    retain failed: %s\n", status.msg ? status.msg : "unknown");
+        TEST_FAIL("hive_msg_retain failed");
+        hive_exit();
+    }
+
+    // Receiving again would normally invalidate 'first'
+    hive_message second;
+    hive_ipc_recv(&second, 0);
+    if (strcmp((const char *)first.data, "first") == 0 &&
+        strcmp((const char *)second.data, "second") == 0) {
+        TEST_PASS("retained payload valid after next receive");
+    } else {
+        TEST_FAIL("retained payload was overwritten");
+    }
+
+    if (HIVE_SUCCEEDED(hive_msg_retain(&first))) {
+        TEST_PASS("retaining an already retained message is a no-op");
+    } else {
+        TEST_FAIL("re-retain should succeed");
+    }
+
+    if (HIVE_SUCCEEDED(hive_msg_release(&first))) {
+        TEST_PASS("hive_msg_release frees retained message");
+    } else {
+        TEST_FAIL("hive_msg_release failed");
+    }
+
+    hive_exit();
+}
+
+// ============================================================================
+// Test 24: Retain/release error cases
+// ============================================================================
+
+static void test24_msg_retain_errors(void *args,
+                                     const hive_spawn_info *siblings,
+                                     size_t sibling_count) {
+    (void)args;
+    (void)siblings;
+    (void)sibling_count;
+    printf("\nTest 24: Retain/release error cases\n");
+
+    actor_id self = hive_self();
+    hive_ipc_notify(self, 1, "a", 2);
+    hive_ipc_notify(self, 2, "b", 2);
+
+    hive_message a;
+    hive_message b;
+    hive_ipc_recv(&a, 0);
+    hive_ipc_recv(&b, 0);
+
+    // 'a' is no longer the active message
+    if (hive_msg_retain(&a).code == HIVE_ERR_INVALID) {
+        TEST_PASS("retain of stale message rejected");
+    } else {
+        TEST_FAIL("retain of stale message should fail");
+    }
+
+    if (hive_msg_release(&b).code == HIVE_ERR_INVALID) {
+        TEST_PASS("release of non-retained message rejected");
+    } else {
+        TEST_FAIL("release of non-retained message should fail");
+    }
+
+    hive_msg_retain(&b);
+    hive_msg_release(&b);
+    if (hive_msg_release(&b).code == HIVE_ERR_INVALID) {
+        TEST_PASS("double release rejected");
+    } else {
+        TEST_FAIL("double release should fail");
+    }
+
+    hive_exit();
+}
+
+// ============================================================================
+// Test 25: Batched server with deferred replies
+// ============================================================================
+
+#define TEST25_CLIENTS 3
+
+static void test25_batch_server(void *args, const hive_spawn_info *siblings,
+                                size_t sibling_count) {
+    (void)args;
+    (void)siblings;
+    (void)sibling_count;
+
+    // Collect a full batch before answering anyone
+    hive_message reqs[TEST25_CLIENTS];
+    hive_reply_handle handles[TEST25_CLIENTS];
+    for (int i = 0; i < TEST25_CLIENTS; i++) {
+        if (HIVE_FAILED(hive_ipc_recv_match(HIVE_SENDER_ANY, HIVE_MSG_REQUEST,
+                                            HIVE_TAG_ANY, &reqs[i], 1000))) {
+            hive_exit();
+        }
+        hive_msg_retain(&reqs[i]);
+        hive_ipc_defer_reply(&reqs[i], &handles[i]);
+    }
+
+    // Reply to every client with the batch sum
+    int sum = 0;
+    for (int i = 0; i < TEST25_CLIENTS; i++) {
+        sum += *(const int *)reqs[i].data;
+    }
+    for (int i = 0; i < TEST25_CLIENTS; i++) {
+        hive_msg_release(&reqs[i]);
+        hive_ipc_reply_deferred(&handles[i], &sum, sizeof(sum));
+    }
+
+    hive_exit();
+}
+
+typedef struct {
+    actor_id server;
+    actor_id parent;
+    int value;
+} test25_client_args;
+
+static void test25_client(void *args, const hive_spawn_info *siblings,
+                          size_t sibling_count) {
+    (void)siblings;
+    (void)sibling_count;
+    test25_client_args *a = args;
+
+    hive_message reply;
+    int result = -1;
+    if (HIVE_SUCCEEDED(hive_ipc_request(a->server, &a->value,
+                                        sizeof(a->value), &reply, 1000))) {
+        result = *(const int *)reply.data;
+    }
+    hive_ipc_notify(a->parent, 25, &result, sizeof(result));
+    hive_exit();
+}
+
+static void test25_deferred_reply(void *args, const hive_spawn_info *siblings,
+                                  size_t sibling_count) {
+    (void)args;
+    (void)siblings;
+    (void)sibling_count;
+    printf("\nTest 25: Batched server with deferred replies\n");
+
+    actor_id server;
+    hive_spawn(test25_batch_server, NULL, NULL, NULL, &server);
+
+    test25_client_args cargs[TEST25_CLIENTS];
+    for (int i = 0; i < TEST25_CLIENTS; i++) {
+        cargs[i] = (test25_client_args){server, hive_self(), i + 1};
+        actor_id client;
+        hive_spawn(test25_client, NULL, &cargs[i], NULL, &client);
+    }
+
+    int ok = 0;
+    for (int i = 0; i < TEST25_CLIENTS; i++) {
+        hive_message msg;
+        if (HIVE_SUCCEEDED(hive_ipc_recv_match(HIVE_SENDER_ANY, HIVE_MSG_NOTIFY,
+                                               25, &msg, 2000)) &&
+            *(const int *)msg.data == 6) {
+            ok++;
+        }
+    }
+
+    if (ok == TEST25_CLIENTS) {
+        TEST_PASS("all clients received batched deferred reply");
+    } else {
+        printf("    %d/%d clients got correct reply\n", ok, TEST25_CLIENTS);
+        TEST_FAIL("deferred replies missing or wrong");
+    }
+
+    hive_message msg;
+    hive_reply_handle handle;
+    hive_ipc_notify(hive_self(), 1, NULL, 0);
+    hive_ipc_recv(&msg, 0);
+    if (hive_ipc_defer_reply(&msg, &handle).code == HIVE_ERR_INVALID) {
+        TEST_PASS("defer_reply rejects non-REQUEST messages");
+    } else {
+        TEST_FAIL("defer_reply should reject non-REQUEST messages");
+    }
+
+    hive_exit();
+}
+
+// ============================================================================
+// Test 26: Forward preserves sender, class and tag
+// ============================================================================
+
+static void test26_sink(void *args, const hive_spawn_info *siblings,
+                        size_t sibling_count) {
+    (void)siblings;
+    (void)sibling_count;
+    actor_id parent = *(actor_id *)args;
+
+    hive_message msg;
+    if (HIVE_SUCCEEDED(hive_ipc_recv(&msg, 1000))) {
+        // Report what arrived: original sender, class, tag and payload
+        uint32_t report[4] = {msg.sender, msg.class, msg.tag,
+                              (uint32_t) * (const int *)msg.data};
+        hive_ipc_notify(parent, 26, report, sizeof(report));
+    }
+    hive_exit();
+}
+
+static void test26_forward(void *args, const hive_spawn_info *siblings,
+                           size_t sibling_count) {
+    (void)args;
+    (void)siblings;
+    (void)sibling_count;
+    printf("\nTest 26: Forward preserves sender, class and tag\n");
+
+    actor_id self = hive_self();
+    actor_id sink;
+    hive_spawn(test26_sink, NULL, &self, NULL, &sink);
+
+    int value = 1234;
+    hive_ipc_notify_ex(self, HIVE_MSG_REQUEST, 77, &value, sizeof(value));
+
+    hive_message msg;
+    hive_ipc_recv(&msg, 0);
+    hive_status status = hive_ipc_forward(&msg, sink);
+    if (HIVE_FAILED(status)) {
+        printf("    forward failed: %s\n", status.msg ? status.msg : "?");
+        TEST_FAIL("hive_ipc_forward failed");
+        hive_exit();
+    }
+
+    hive_message report_msg;
+    status = hive_ipc_recv_match(sink, HIVE_MSG_NOTIFY, 26, &report_msg, 1000);
+    if (HIVE_FAILED(status)) {
+        TEST_FAIL("sink did not receive forwarded message");
+        hive_exit();
+    }
+
+    const uint32_t *report = report_msg.data;
+    if (report[0] == self && report[1] == HIVE_MSG_REQUEST && report[2] == 77 &&
+        report[3] == 1234) {
+        TEST_PASS("forwarded message keeps original sender, class and tag");
+    } else {
+        printf("    sender=%u class=%u tag=%u value=%u\n", report[0],
+               report[1], report[2], report[3]);
+        TEST_FAIL("forwarded message header changed");
+    }
+
+    // Forwarded message no longer belongs to the caller
+    if (hive_ipc_forward(&msg, sink).code == HIVE_ERR_INVALID) {
+        TEST_PASS("forwarding twice is rejected");
+    } else {
+        TEST_FAIL("second forward should fail");
+    }
+
+    // Failed forward leaves the message with the caller
+    hive_ipc_notify(self, 1, &value, sizeof(value));
+    hive_ipc_recv(&msg, 0);
+    if (hive_ipc_forward(&msg, ACTOR_ID_INVALID).code == HIVE_ERR_INVALID &&
+        *(const int *)msg.data == 1234) {
+        TEST_PASS("forward to invalid actor keeps message valid");
+    } else {
+        TEST_FAIL("forward to invalid actor");
+    }
+
+    hive_exit();
+}
+
+// ============================================================================
+// Test 27: Request through a forwarding proxy
+// ============================================================================
+
+static void test27_proxy(void *args, const hive_spawn_info *siblings,
+                         size_t sibling_count) {
+    (void)siblings;
+    (void)sibling_count;
+    actor_id server = *(actor_id *)args;
+
+    // Stay alive while requests are in flight: hive_ipc_request() monitors
+    // the proxy, not the server behind it
+    hive_message msg;
+    while (HIVE_SUCCEEDED(hive_ipc_recv(&msg, 200))) {
+        hive_ipc_forward(&msg, server);
+    }
+    hive_exit();
+}
+
+static void test27_request_via_proxy(void *args,
+                                     const hive_spawn_info *siblings,
+                                     size_t sibling_count) {
+    (void)args;
+    (void)siblings;
+    (void)sibling_count;
+    printf("\nTest 27: Request through a forwarding proxy\n");
+
+    actor_id server;
+    hive_spawn(request_reply_server_actor, NULL, NULL, NULL, &server);
+    actor_id proxy;
+    hive_spawn(test27_proxy, NULL, &server, NULL, &proxy);
+
+    int request = 50;
+    hive_message reply;
+    hive_status status =
+        hive_ipc_request(proxy, &request, sizeof(request), &reply, 1000);
+
+    if (HIVE_SUCCEEDED(status) && *(const int *)reply.data == 100 &&
+        reply.sender == server) {
+        TEST_PASS("server replies directly to originator of forwarded request");
+    } else {
+        printf("    status=%d (%s)\n", status.code,
+               status.msg ? status.msg : "");
+        TEST_FAIL("request via proxy failed");
+    }
+
+    hive_exit();
+}
+
+// ============================================================================
+// Test 28: Multicast to a list of actors
+// ============================================================================
+
+static void test28_receiver(void *args, const hive_spawn_info *siblings,
+                            size_t sibling_count) {
+    (void)siblings;
+    (void)sibling_count;
+    actor_id parent = *(actor_id *)args;
+
+    hive_message msg;
+    if (HIVE_SUCCEEDED(hive_ipc_recv_match(HIVE_SENDER_ANY, HIVE_MSG_NOTIFY, 28,
+                                           &msg, 1000))) {
+        hive_ipc_notify(parent, 29, msg.data, msg.len);
+    }
+    hive_exit();
+}
+
+static void test28_multicast_list(void *args, const hive_spawn_info *siblings,
+                                  size_t sibling_count) {
+    (void)args;
+    (void)siblings;
+    (void)sibling_count;
+    printf("\nTest 28: Multicast to a list of actors\n");
+
+    actor_id self = hive_self();
+    actor_id to[3];
+    for (int i = 0; i < 3; i++) {
+        hive_spawn(test28_receiver, NULL, &self, NULL, &to[i]);
+    }
+
+    // Invalid recipient anywhere in the list rejects the whole send
+    actor_id bad[2] = {to[0], ACTOR_ID_INVALID};
+    if (hive_ipc_multicast_list(bad, 2, 28, "x", 2).code == HIVE_ERR_INVALID) {
+        TEST_PASS("invalid recipient rejects whole multicast");
+    } else {
+        TEST_FAIL("invalid recipient should be rejected");
+    }
+
+    hive_status status = hive_ipc_multicast_list(to, 3, 28, "fan", 4);
+    int ok = 0;
+    for (int i = 0; i < 3 && HIVE_SUCCEEDED(status); i++) {
+        hive_message msg;
+        if (HIVE_SUCCEEDED(hive_ipc_recv_match(HIVE_SENDER_ANY,
+                                               HIVE_MSG_NOTIFY, 29, &msg,
+                                               1000)) &&
+            strcmp((const char *)msg.data, "fan") == 0) {
+            ok++;
+        }
+    }
+
+    // The first (rejected) multicast must not have reached to[0]
+    if (ok == 3) {
+        TEST_PASS("every listed actor received the multicast once");
+    } else {
+        printf("    %d/3 receivers got correct payload\n", ok);
+        TEST_FAIL("multicast list delivery");
+    }
+
+    hive_exit();
+}
+
+// ============================================================================
+// Test 29: Urgent lane bypasses a deep mailbox
+// ============================================================================
+
+#define TEST29_TAG_DATA 290
+#define TEST29_TAG_STOP 291
+#define TEST29_TAG_DONE 292
+
+// Deepest backlog the pools allow (target 10k), leaving headroom for others
+static size_t test29_depth(void) {
+    size_t depth = 10000;
+    if (depth > HIVE_MAILBOX_ENTRY_POOL_SIZE - 16) {
+        depth = HIVE_MAILBOX_ENTRY_POOL_SIZE - 16;
+    }
+    if (depth > HIVE_MESSAGE_DATA_POOL_SIZE - 16) {
+        depth = HIVE_MESSAGE_DATA_POOL_SIZE - 16;
+    }
+    return depth;
+}
+
+// Counts data messages handled before the stop request arrives
+static void test29_worker(void *args, const hive_spawn_info *siblings,
+                          size_t sibling_count) {
+    (void)siblings;
+    (void)sibling_count;
+    actor_id parent = *(actor_id *)args;
+
+    uint32_t drained = 0;
+    hive_message msg;
+    while (HIVE_SUCCEEDED(hive_ipc_recv(&msg, 1000))) {
+        if (msg.tag == TEST29_TAG_STOP) {
+            break;
+        }
+        drained++;
+    }
+    hive_ipc_notify(parent, TEST29_TAG_DONE, &drained, sizeof(drained));
+    hive_exit();
+}
+
+static void test29_urgent_lane(void *args, const hive_spawn_info *siblings,
+                               size_t sibling_count) {
+    (void)args;
+    (void)siblings;
+    (void)sibling_count;
+    printf("\nTest 29: Urgent lane bypasses a deep mailbox\n");
+
+    // Ordering: urgent messages are FIFO among themselves, ahead of the rest
+    actor_id self = hive_self();
+    int v1 = 1, v2 = 2, u1 = 10, u2 = 20;
+    hive_ipc_notify(self, TEST29_TAG_DATA, &v1, sizeof(v1));
+    hive_ipc_notify_urgent(self, TEST29_TAG_STOP, &u1, sizeof(u1));
+    hive_ipc_notify(self, TEST29_TAG_DATA, &v2, sizeof(v2));
+    hive_ipc_notify_urgent(self, TEST29_TAG_STOP, &u2, sizeof(u2));
+
+    int expected[] = {u1, u2, v1, v2};
+    bool ordered = true;
+    for (int i = 0; i < 4; i++) {
+        hive_message msg;
+        if (HIVE_FAILED(hive_ipc_recv(&msg, 0)) ||
+            *(const int *)msg.data != expected[i]) {
+            ordered = false;
+        }
+    }
+    if (ordered && !hive_ipc_pending()) {
+        TEST_PASS("urgent messages are received first, in send order");
+    } else {
+        TEST_FAIL("urgent lane ordering");
+    }
+
+    // Stop latency: worker with a deep backlog must see stop immediately
+    size_t depth = test29_depth();
+    actor_id worker;
+    hive_spawn(test29_worker, NULL, &self, NULL, &worker);
+
+    uint8_t payload[32] = {0};
+    size_t queued = 0;
+    while (queued < depth && HIVE_SUCCEEDED(hive_ipc_notify(
+                                 worker, TEST29_TAG_DATA, payload,
+                                 sizeof(payload)))) {
+        queued++;
+    }
+
+    uint64_t start = time_ms();
+    hive_ipc_notify_urgent(worker, TEST29_TAG_STOP, NULL, 0);
+    hive_message msg;
+    hive_status status = hive_ipc_recv_match(worker, HIVE_MSG_NOTIFY,
+                                             TEST29_TAG_DONE, &msg, 5000);
+    uint64_t elapsed = time_ms() - start;
+
+    uint32_t drained = HIVE_SUCCEEDED(status) ? *(const uint32_t *)msg.data
+                                              : UINT32_MAX;
+    printf("    %zu queued, %u drained before stop, %lu ms\n", queued,
+           drained, (unsigned long)elapsed);
+    if (drained == 0) {
+        TEST_PASS("stop overtakes the whole backlog");
+    } else {
+        TEST_FAIL("stop waited behind data messages");
+    }
+
+    hive_exit();
+}
+
+// ============================================================================
+// Test 30: Tag prefix filters
+// ============================================================================
+
+#define TEST30_FAMILY 0x0555000
+#define TEST30_OTHER 0x0556000
+
+static void test30_sender(void *args, const hive_spawn_info *siblings,
+                          size_t sibling_count) {
+    (void)siblings;
+    (void)sibling_count;
+    actor_id parent = *(actor_id *)args;
+
+    // First message must not wake the parent, the second must
+    hive_ipc_notify(parent, TEST30_OTHER, NULL, 0);
+    hive_ipc_notify(parent, TEST30_FAMILY | 0xABC, NULL, 0);
+    hive_exit();
+}
+
+static void test30_tag_prefix(void *args, const hive_spawn_info *siblings,
+                              size_t sibling_count) {
+    (void)args;
+    (void)siblings;
+    (void)sibling_count;
+    printf("\nTest 30: Tag prefix filters\n");
+
+    actor_id self = hive_self();
+    uint32_t family = HIVE_TAG_PREFIX(TEST30_FAMILY, 12);
+    hive_ipc_notify(self, TEST30_OTHER, NULL, 0);
+    hive_ipc_notify(self, TEST30_FAMILY | 0x001, NULL, 0);
+    hive_ipc_notify(self, TEST30_FAMILY | 0xFFF, NULL, 0);
+
+    hive_message m1, m2, m3;
+    hive_ipc_recv_match(HIVE_SENDER_ANY, HIVE_MSG_NOTIFY, family, &m1, 0);
+    hive_ipc_recv_match(HIVE_SENDER_ANY, HIVE_MSG_NOTIFY, family, &m2, 0);
+    hive_status s3 =
+        hive_ipc_recv_match(HIVE_SENDER_ANY, HIVE_MSG_NOTIFY, family, &m3, 0);
+    if (m1.tag == (TEST30_FAMILY | 0x001) &&
+        m2.tag == (TEST30_FAMILY | 0xFFF) &&
+        s3.code == HIVE_ERR_WOULDBLOCK) {
+        TEST_PASS("prefix filter matches the whole tag family only");
+    } else {
+        TEST_FAIL("prefix filter matching");
+    }
+
+    hive_message other;
+    hive_ipc_recv(&other, 0); // Drop TEST30_OTHER
+
+    actor_id sender;
+    hive_spawn(test30_sender, NULL, &self, NULL, &sender);
+    hive_message msg;
+    hive_status status =
+        hive_ipc_recv_match(sender, HIVE_MSG_NOTIFY, family, &msg, 1000);
+    if (HIVE_SUCCEEDED(status) && msg.tag == (TEST30_FAMILY | 0xABC)) {
+        TEST_PASS("blocked prefix receive wakes only on a family tag");
+    } else {
+        TEST_FAIL("blocked prefix receive");
+    }
+    hive_ipc_recv(&other, 0);
+
+    hive_exit();
+}
+
 // ============================================================================
 // Test runner
 // ============================================================================
@@ -1115,6 +1671,14 @@ static void (*test_funcs[])(void *, const hive_spawn_info *, size_t) = {
     test20_multi_filter_second,
     test21_multi_filter_timeout,
     test22_multi_filter_nonblocking,
+    test23_msg_retain,
+    test24_msg_retain_errors,
+    test25_deferred_reply,
+    test26_forward,
+    test27_request_via_proxy,
+    test28_multicast_list,
+    test29_urgent_lane,
+    test30_tag_prefix,
 };
 
 #define NUM_TESTS (sizeof(test_funcs) / sizeof(test_funcs[0]))
@@ -4,6 +4,7 @@
 #include "hive_bus.h"
 #include "hive_timer.h"
 #include "hive_link.h"
+#include "hive_static_config.h"
 #include <stdio.h>
 #include <string.h>
 #include <time.h>
@@ -617,6 +618,20 @@ static void test10_error_cases(void *args, const hive_spawn_info *siblings,
         TEST_FAIL("expected INVALID for unsubscribed bus");
     }
 
+    // More IPC sources than can be compiled (limit is 16)
+    hive_select_source many[17];
+    for (size_t i = 0; i < 17; i++) {
+        many[i] = (hive_select_source){
+            .type = HIVE_SEL_IPC,
+            .ipc = {HIVE_SENDER_ANY, HIVE_MSG_NOTIFY, (uint32_t)i}};
+    }
+    status = hive_select(many, 17, &result, 0);
+    if (status.code == HIVE_ERR_INVALID) {
+        TEST_PASS("too many IPC sources rejected");
+    } else {
+        TEST_FAIL("expected INVALID for 17 IPC sources");
+    }
+
     hive_exit();
 }
 
@@ -663,6 +678,165 @@ static void test11_immediate_return(void *args, const hive_spawn_info *siblings,
     hive_exit();
 }
 
+// ============================================================================
+// Test 12: Absolute deadlines (hive_select_until)
+// ============================================================================
+
+static void test12_deadline(void *args, const hive_spawn_info *siblings,
+                            size_t sibling_count) {
+    (void)args;
+    (void)siblings;
+    (void)sibling_count;
+    printf("\nTest 12: Absolute deadlines (hive_select_until)\n");
+
+    hive_select_source source = {
+        .type = HIVE_SEL_IPC, .ipc = {HIVE_SENDER_ANY, HIVE_MSG_NOTIFY, 9999}};
+    hive_select_result result;
+
+    hive_status status =
+        hive_select_until(&source, 1, &result, HIVE_DEADLINE_NOW);
+    if (status.code == HIVE_ERR_WOULDBLOCK) {
+        TEST_PASS("HIVE_DEADLINE_NOW returns WOULDBLOCK");
+    } else {
+        printf("    status=%d\n", status.code);
+        TEST_FAIL("expected WOULDBLOCK");
+    }
+
+    status = hive_select_until(&source, 1, &result, 1);
+    if (status.code == HIVE_ERR_TIMEOUT) {
+        TEST_PASS("deadline in the past returns TIMEOUT without blocking");
+    } else {
+        printf("    status=%d\n", status.code);
+        TEST_FAIL("expected TIMEOUT");
+    }
+
+    uint64_t deadline = hive_get_time() + 50000;
+    status = hive_select_until(&source, 1, &result, deadline);
+    uint64_t now = hive_get_time();
+    if (status.code == HIVE_ERR_TIMEOUT && now >= deadline &&
+        now - deadline < 50000) {
+        printf("    woke %lu us after the deadline\n",
+               (unsigned long)(now - deadline));
+        TEST_PASS("select returns TIMEOUT at the deadline");
+    } else {
+        printf("    status=%d, now - deadline=%ld us\n", status.code,
+               (long)(now - deadline));
+        TEST_FAIL("deadline missed");
+    }
+
+    hive_exit();
+}
+
+// ============================================================================
+// Test 13: One deadline bounds a loop of receives
+// ============================================================================
+
+static actor_id s_ping_target;
+
+// Sends a message every 20ms, 8 times
+static void pinger_actor(void *args, const hive_spawn_info *siblings,
+                         size_t sibling_count) {
+    (void)args;
+    (void)siblings;
+    (void)sibling_count;
+    for (int i = 0; i < 8; i++) {
+        hive_sleep(20000);
+        hive_ipc_notify(s_ping_target, TAG_B, NULL, 0);
+    }
+    hive_exit();
+}
+
+static void test13_deadline_loop(void *args, const hive_spawn_info *siblings,
+                                 size_t sibling_count) {
+    (void)args;
+    (void)siblings;
+    (void)sibling_count;
+    printf("\nTest 13: One deadline bounds a loop of receives\n");
+
+    // A relative 100ms timeout restarts with every message and this loop
+    // would run until the pinger stops; the shared deadline ends it on time
+    s_ping_target = hive_self();
+    actor_id pinger;
+    if (HIVE_FAILED(hive_spawn(pinger_actor, NULL, NULL, NULL, &pinger))) {
+        TEST_FAIL("spawn pinger");
+        hive_exit();
+    }
+
+    uint64_t start = time_ms();
+    uint64_t deadline = hive_get_time() + 100000;
+    int received = 0;
+    hive_status status;
+    hive_message msg;
+    while (HIVE_SUCCEEDED(
+        status = hive_ipc_recv_match_until(HIVE_SENDER_ANY, HIVE_MSG_NOTIFY,
+                                           TAG_B, &msg, deadline))) {
+        received++;
+    }
+    uint64_t elapsed = time_ms() - start;
+
+    if (status.code == HIVE_ERR_TIMEOUT && received >= 2 && received <= 5 &&
+        elapsed >= 95 && elapsed <= 150) {
+        printf("    %d messages, loop ended after %lu ms\n", received,
+               (unsigned long)elapsed);
+        TEST_PASS("receive loop ends at the shared deadline");
+    } else {
+        printf("    status=%d, %d messages, elapsed=%lu ms\n", status.code,
+               received, (unsigned long)elapsed);
+        TEST_FAIL("receive loop overran its deadline");
+    }
+
+    hive_exit();
+}
+
+// ============================================================================
+// Test 14: Timeouts do not use the timer pool
+// ============================================================================
+
+static void test14_no_timer_alloc(void *args, const hive_spawn_info *siblings,
+                                  size_t sibling_count) {
+    (void)args;
+    (void)siblings;
+    (void)sibling_count;
+    printf("\nTest 14: Timeouts do not use the timer pool\n");
+
+    // Exhaust the timer pool
+    static timer_id timers[HIVE_TIMER_ENTRY_POOL_SIZE];
+    size_t created = 0;
+    while (created < HIVE_TIMER_ENTRY_POOL_SIZE &&
+           HIVE_SUCCEEDED(hive_timer_after(10000000, &timers[created]))) {
+        created++;
+    }
+    timer_id extra;
+    if (hive_timer_after(10000000, &extra).code != HIVE_ERR_NOMEM) {
+        TEST_FAIL("timer pool not exhausted");
+    }
+
+    hive_message msg;
+    hive_status status = hive_ipc_recv(&msg, 20);
+    if (status.code == HIVE_ERR_TIMEOUT) {
+        TEST_PASS("recv with timeout works with the timer pool exhausted");
+    } else {
+        printf("    status=%d\n", status.code);
+        TEST_FAIL("expected TIMEOUT, not a pool error");
+    }
+
+    uint64_t start = time_ms();
+    status = hive_sleep(20000);
+    uint64_t elapsed = time_ms() - start;
+    if (HIVE_SUCCEEDED(status) && elapsed >= 19) {
+        TEST_PASS("sleep works with the timer pool exhausted");
+    } else {
+        printf("    status=%d, elapsed=%lu ms\n", status.code,
+               (unsigned long)elapsed);
+        TEST_FAIL("sleep failed with the timer pool exhausted");
+    }
+
+    for (size_t i = 0; i < created; i++) {
+        hive_timer_cancel(timers[i]);
+    }
+    hive_exit();
+}
+
 // ============================================================================
 // Test runner
 // ============================================================================
@@ -671,7 +845,8 @@ static void (*test_funcs[])(void *, const hive_spawn_info *, size_t) = {
     test1_ipc_wildcard,    test2_ipc_filtered,      test3_bus_source,
     test4_ipc_multi_first, test5_ipc_multi_second,  test6_bus_multi,
     test7_mixed_sources,   test8_priority_order,    test9_timeout,
-    test10_error_cases,    test11_immediate_return,
+    test10_error_cases,    test11_immediate_return, test12_deadline,
+    test13_deadline_loop,  test14_no_timer_alloc,
 };
 
 #define NUM_TESTS (sizeof(test_funcs) / sizeof(test_funcs[0]))
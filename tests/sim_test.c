@@ -0,0 +1,320 @@
+#include "hive_runtime.h"
+#include "hive_ipc.h"
+#include "hive_timer.h"
+#include "hive_bus.h"
+#include <stdio.h>
+#include <stdint.h>
+
+/* TEST_STACK_SIZE caps stack for QEMU builds; passes through on native */
+#ifndef TEST_STACK_SIZE
+#define TEST_STACK_SIZE(x) (x)
+#endif
+
+// Simulation mode is process-wide and cannot be left once entered, so these
+// tests live in their own binary and drive the runtime from main() the way
+// a simulation harness does, instead of from a runner actor
+
+// Test results
+static int tests_passed = 0;
+static int tests_failed = 0;
+
+#define TEST_PASS(name)               \
+    do {                              \
+        printf("  PASS: %s\n", name); \
+        fflush(stdout);               \
+        tests_passed++;               \
+    } while (0)
+#define TEST_FAIL(name)               \
+    do {                              \
+        printf("  FAIL: %s\n", name); \
+        fflush(stdout);               \
+        tests_failed++;               \
+    } while (0)
+
+static actor_id spawn(actor_fn fn, void *args) {
+    actor_config cfg = HIVE_ACTOR_CONFIG_DEFAULT;
+    cfg.stack_size = TEST_STACK_SIZE(64 * 1024);
+    actor_id id = ACTOR_ID_INVALID;
+    hive_spawn(fn, NULL, args, &cfg, &id);
+    return id;
+}
+
+// ============================================================================
+// Test 1: Time jumps straight to a distant deadline
+// ============================================================================
+
+static void sleeper_actor(void *args, const hive_spawn_info *siblings,
+                          size_t sibling_count) {
+    (void)siblings;
+    (void)sibling_count;
+    uint64_t *times = args;
+
+    // First run enters simulation mode: time is simulated from here on
+    times[0] = hive_get_time();
+    hive_sleep(10000000); // 10 simulated seconds
+    times[1] = hive_get_time();
+    hive_exit();
+}
+
+static void test1_jump_to_deadline(void) {
+    printf("\nTest 1: Time jumps straight to a distant deadline\n");
+
+    uint64_t times[2] = {0, 0};
+    spawn(sleeper_actor, times);
+
+    hive_status status = hive_run_until_idle_sim(UINT64_MAX);
+    if (HIVE_SUCCEEDED(status) && times[1] == times[0] + 10000000) {
+        TEST_PASS("sleeper woke exactly at its deadline");
+    } else {
+        printf("    woke at +%lu us\n", (unsigned long)(times[1] - times[0]));
+        TEST_FAIL("sleeper woke at the wrong time");
+    }
+
+    if (hive_get_time() == times[1]) {
+        TEST_PASS("returns when all actors have exited");
+    } else {
+        TEST_FAIL("time advanced past the last event");
+    }
+}
+
+// ============================================================================
+// Test 2: Receive timeouts fire on simulated time
+// ============================================================================
+
+static void timeout_actor(void *args, const hive_spawn_info *siblings,
+                          size_t sibling_count) {
+    (void)siblings;
+    (void)sibling_count;
+    uint64_t *timed_out_at = args;
+
+    hive_message msg;
+    if (hive_ipc_recv(&msg, 50).code == HIVE_ERR_TIMEOUT) {
+        *timed_out_at = hive_get_time();
+    }
+    hive_exit();
+}
+
+static void test2_recv_timeout(void) {
+    printf("\nTest 2: Receive timeouts fire on simulated time\n");
+
+    uint64_t timed_out_at = 0;
+    uint64_t start = hive_get_time();
+    spawn(timeout_actor, &timed_out_at);
+
+    hive_run_until_idle_sim(UINT64_MAX);
+    if (timed_out_at == start + 50000) {
+        TEST_PASS("50ms receive timeout fired at +50ms");
+    } else {
+        printf("    timed out at +%lu us\n",
+               (unsigned long)(timed_out_at - start));
+        TEST_FAIL("receive timeout at the wrong time");
+    }
+}
+
+// ============================================================================
+// Test 3: until_us bounds the run; a later call resumes
+// ============================================================================
+
+#define TICKER_TICKS 150
+
+static void ticker_actor(void *args, const hive_spawn_info *siblings,
+                         size_t sibling_count) {
+    (void)siblings;
+    (void)sibling_count;
+    int *ticks = args;
+
+    timer_id timer;
+    hive_timer_every(1000, &timer);
+    while (*ticks < TICKER_TICKS) {
+        hive_message msg;
+        hive_ipc_recv_match(HIVE_SENDER_ANY, HIVE_MSG_TIMER, timer, &msg, -1);
+        (*ticks)++;
+    }
+    hive_timer_cancel(timer);
+    hive_exit();
+}
+
+static void test3_until_bound(void) {
+    printf("\nTest 3: until_us bounds the run; a later call resumes\n");
+
+    int ticks = 0;
+    uint64_t start = hive_get_time();
+    spawn(ticker_actor, &ticks);
+
+    hive_run_until_idle_sim(start + 100000);
+    if (hive_get_time() == start + 100000 && ticks == 100) {
+        TEST_PASS("stops at until_us with every due tick delivered");
+    } else {
+        printf("    time +%lu us, %d ticks\n",
+               (unsigned long)(hive_get_time() - start), ticks);
+        TEST_FAIL("until_us bound not honoured");
+    }
+
+    hive_run_until_idle_sim(UINT64_MAX);
+    if (ticks == TICKER_TICKS &&
+        hive_get_time() == start + TICKER_TICKS * 1000) {
+        TEST_PASS("resumes and runs to completion");
+    } else {
+        printf("    time +%lu us, %d ticks\n",
+               (unsigned long)(hive_get_time() - start), ticks);
+        TEST_FAIL("resume after until_us");
+    }
+}
+
+// ============================================================================
+// Test 4: Returns at once when only timerless waits remain
+// ============================================================================
+
+static void blocked_actor(void *args, const hive_spawn_info *siblings,
+                          size_t sibling_count) {
+    (void)siblings;
+    (void)sibling_count;
+    bool *ran = args;
+
+    *ran = true;
+    hive_message msg;
+    hive_ipc_recv(&msg, -1); // Nothing will ever arrive
+    hive_exit();
+}
+
+static void test4_idle(void) {
+    printf("\nTest 4: Returns at once when only timerless waits remain\n");
+
+    bool ran = false;
+    uint64_t start = hive_get_time();
+    spawn(blocked_actor, &ran);
+
+    hive_status status = hive_run_until_idle_sim(UINT64_MAX);
+    if (HIVE_SUCCEEDED(status) && ran && hive_get_time() == start) {
+        TEST_PASS("idle with no pending timer, time unchanged");
+    } else {
+        TEST_FAIL("idle detection");
+    }
+}
+
+// ============================================================================
+// Test 5: Bus max_age_ms expiry follows simulated time
+// ============================================================================
+
+static void bus_age_actor(void *args, const hive_spawn_info *siblings,
+                          size_t sibling_count) {
+    (void)siblings;
+    (void)sibling_count;
+    bool *fresh = args;
+
+    hive_bus_config cfg = HIVE_BUS_CONFIG_DEFAULT;
+    cfg.max_age_ms = 100;
+    bus_id bus;
+    hive_bus_create(&cfg, &bus);
+    hive_bus_subscribe(bus);
+
+    int value = 1;
+    size_t len;
+    hive_bus_publish(bus, &value, sizeof(value));
+    hive_sleep(99000); // 99ms old: still fresh
+    fresh[0] = HIVE_SUCCEEDED(hive_bus_read(bus, &value, sizeof(value), &len));
+
+    hive_bus_publish(bus, &value, sizeof(value));
+    hive_sleep(100000); // 100ms old: expired
+    fresh[1] = HIVE_SUCCEEDED(hive_bus_read(bus, &value, sizeof(value), &len));
+
+    hive_bus_unsubscribe(bus);
+    hive_bus_destroy(bus);
+    hive_exit();
+}
+
+static void test5_bus_max_age(void) {
+    printf("\nTest 5: Bus max_age_ms expiry follows simulated time\n");
+
+    bool fresh[2] = {false, true};
+    spawn(bus_age_actor, fresh);
+    hive_run_until_idle_sim(UINT64_MAX);
+
+    if (fresh[0]) {
+        TEST_PASS("entry kept until max_age_ms");
+    } else {
+        TEST_FAIL("entry expired early");
+    }
+    if (!fresh[1]) {
+        TEST_PASS("entry expired at max_age_ms");
+    } else {
+        TEST_FAIL("entry not expired");
+    }
+}
+
+// ============================================================================
+// Test 6: Absolute deadlines land on their microsecond
+// ============================================================================
+
+static void deadline_actor(void *args, const hive_spawn_info *siblings,
+                           size_t sibling_count) {
+    (void)siblings;
+    (void)sibling_count;
+    uint64_t *times = args;
+
+    times[0] = hive_get_time();
+    hive_sleep_until(times[0] + 4321);
+    times[1] = hive_get_time();
+    hive_message msg;
+    if (hive_ipc_recv_until(&msg, times[0] + 12345).code ==
+        HIVE_ERR_TIMEOUT) {
+        times[2] = hive_get_time();
+    }
+    hive_exit();
+}
+
+static void test6_deadlines(void) {
+    printf("\nTest 6: Absolute deadlines land on their microsecond\n");
+
+    uint64_t times[3] = {0, 0, 0};
+    spawn(deadline_actor, times);
+    hive_run_until_idle_sim(UINT64_MAX);
+
+    // Exact on Linux; tick-based backends round up to the next tick
+    uint64_t slept = times[1] - times[0];
+    uint64_t timed_out = times[2] - times[0];
+    if (slept >= 4321 && slept < 4321 + 1000) {
+        TEST_PASS("hive_sleep_until woke at its deadline");
+    } else {
+        printf("    woke at +%lu us\n", (unsigned long)slept);
+        TEST_FAIL("sleep deadline missed");
+    }
+    if (times[2] && timed_out >= 12345 && timed_out < 12345 + 1000) {
+        TEST_PASS("hive_ipc_recv_until timed out at its deadline");
+    } else {
+        printf("    timed out at +%lu us\n", (unsigned long)timed_out);
+        TEST_FAIL("receive deadline missed");
+    }
+}
+
+// ============================================================================
+// Test runner
+// ============================================================================
+
+int main(void) {
+    printf("=== Event-Driven Simulation Test Suite ===\n");
+
+    hive_status status = hive_init();
+    if (HIVE_FAILED(status)) {
+        fprintf(stderr, "Failed to initialize runtime: %s\n",
+                status.msg ? status.msg : "unknown error");
+        return 1;
+    }
+
+    test1_jump_to_deadline();
+    test2_recv_timeout();
+    test3_until_bound();
+    test4_idle();
+    test5_bus_max_age();
+    test6_deadlines();
+
+    hive_cleanup();
+
+    printf("\n=== Results ===\n");
+    printf("Passed: %d\n", tests_passed);
+    printf("Failed: %d\n", tests_failed);
+    printf("\n%s\n",
+           tests_failed == 0 ? "All tests passed!" : "Some tests FAILED!");
+
+    return tests_failed > 0 ? 1 : 0;
+}
@@ -550,6 +550,306 @@ static void run_timer_tests(void *args, const hive_spawn_info *siblings,
         }
     }
 
+    // ========================================================================
+    // Test 18: Many concurrent timers fire in deadline order
+    // ========================================================================
+    printf("\nTest 18: Many concurrent timers fire in deadline order\n");
+    {
+#define TEST18_TIMERS 16
+        // Created latest-deadline first, so creation order != firing order
+        timer_id timers[TEST18_TIMERS];
+        for (int i = 0; i < TEST18_TIMERS; i++) {
+            hive_timer_after((uint32_t)(TEST18_TIMERS - i) * 3000, &timers[i]);
+        }
+
+        bool ordered = true;
+        int received = 0;
+        for (int i = TEST18_TIMERS - 1; i >= 0; i--) {
+            hive_message msg;
+            if (HIVE_FAILED(hive_ipc_recv_match(HIVE_SENDER_ANY,
+                                                HIVE_MSG_TIMER, HIVE_TAG_ANY,
+                                                &msg, 1000))) {
+                break;
+            }
+            received++;
+            if (msg.tag != timers[i]) {
+                ordered = false;
+            }
+        }
+
+        if (received == TEST18_TIMERS && ordered) {
+            TEST_PASS("all timers fired, earliest deadline first");
+        } else {
+            printf("    received %d/%d, ordered=%d\n", received,
+                   TEST18_TIMERS, ordered);
+            TEST_FAIL("timers fired out of order or went missing");
+        }
+    }
+
+    // ========================================================================
+    // Test 19: Cancelling the earliest timer does not stall later ones
+    // ========================================================================
+    printf("\nTest 19: Cancelling the earliest timer keeps later ones\n");
+    {
+        timer_id early, late;
+        hive_timer_after(10000, &early); // 10ms
+        hive_timer_after(30000, &late);  // 30ms
+        hive_timer_cancel(early);
+
+        uint64_t start = time_ms();
+        hive_message msg;
+        hive_status status = hive_ipc_recv_match(HIVE_SENDER_ANY,
+                                                 HIVE_MSG_TIMER, HIVE_TAG_ANY,
+                                                 &msg, 500);
+        uint64_t elapsed = time_ms() - start;
+
+        if (HIVE_SUCCEEDED(status) && msg.tag == late && elapsed >= 20) {
+            printf("    Later timer fired after %lu ms (expected ~30ms)\n",
+                   (unsigned long)elapsed);
+            TEST_PASS("later timer fires after earliest is cancelled");
+        } else {
+            TEST_FAIL("later timer did not fire correctly");
+        }
+    }
+
+    // ========================================================================
+    // Test 20: Stale timer id cannot cancel a reused slot
+    // ========================================================================
+    printf("\nTest 20: Stale timer id cannot cancel a reused slot\n");
+    {
+        timer_id stale, fresh;
+        hive_timer_after(10000, &stale);
+        hive_timer_cancel(stale);
+        hive_timer_after(10000, &fresh); // Typically reuses the same slot
+
+        hive_status status = hive_timer_cancel(stale);
+        hive_message msg;
+        hive_status fired = hive_ipc_recv_match(HIVE_SENDER_ANY, HIVE_MSG_TIMER,
+                                                fresh, &msg, 500);
+
+        if (stale != fresh && status.code == HIVE_ERR_INVALID &&
+            HIVE_SUCCEEDED(fired)) {
+            TEST_PASS("stale id rejected, new timer unaffected");
+        } else {
+            TEST_FAIL("stale timer id affected a reused slot");
+        }
+    }
+
+    // ========================================================================
+    // Test 21: Absolute periodic timer stays on its start + k * interval grid
+    // ========================================================================
+    printf("\nTest 21: Absolute periodic timer (hive_timer_every_abs)\n");
+    {
+        const uint32_t interval = 10000; // 10ms
+        uint64_t start = hive_get_time() + 20000;
+        timer_id timer;
+        hive_status status = hive_timer_every_abs(start, interval, &timer);
+        if (HIVE_FAILED(status)) {
+            TEST_FAIL("hive_timer_every_abs failed");
+        } else {
+            bool on_grid = true;
+            uint32_t missed = 0;
+            int ticks = 0;
+            for (int k = 0; k < 5; k++) {
+                hive_message msg;
+                if (HIVE_FAILED(hive_ipc_recv_match(HIVE_SENDER_ANY,
+                                                    HIVE_MSG_TIMER, timer,
+                                                    &msg, 500))) {
+                    break;
+                }
+                // Never early: tick k is due at start + (k + missed) * interval
+                missed += hive_timer_missed(&msg);
+                uint64_t due = start + (uint64_t)(k + missed) * interval;
+                if (hive_get_time() < due) {
+                    on_grid = false;
+                }
+                ticks++;
+            }
+
+            hive_timer_stats stats;
+            hive_timer_get_stats(timer, &stats);
+            hive_timer_cancel(timer);
+
+            if (ticks == 5 && on_grid) {
+                TEST_PASS("ticks fire at start + k * interval");
+            } else {
+                printf("    ticks=%d on_grid=%d\n", ticks, on_grid);
+                TEST_FAIL("absolute periodic timer off its grid");
+            }
+            if (stats.ticks == 5 && stats.missed == missed &&
+                stats.max_late_us >= stats.last_late_us) {
+                TEST_PASS("hive_timer_get_stats counts ticks");
+            } else {
+                TEST_FAIL("timer stats inconsistent");
+            }
+        }
+
+        timer_id bad;
+        if (hive_timer_every_abs(start, 0, &bad).code == HIVE_ERR_INVALID &&
+            hive_timer_get_stats(timer, &(hive_timer_stats){0}).code ==
+                HIVE_ERR_INVALID) {
+            TEST_PASS("zero interval and cancelled timer rejected");
+        } else {
+            TEST_FAIL("invalid every_abs/get_stats arguments accepted");
+        }
+        if (hive_timer_every(0, &bad).code == HIVE_ERR_INVALID) {
+            TEST_PASS("hive_timer_every rejects zero interval");
+        } else {
+            TEST_FAIL("hive_timer_every accepted zero interval");
+        }
+    }
+
+    // ========================================================================
+    // Test 22: Overruns are reported as missed periods in the next tick
+    // ========================================================================
+    printf("\nTest 22: Overrun reported in tick payload\n");
+    {
+        const uint32_t interval = 5000; // 5ms
+        timer_id timer;
+        hive_timer_every_abs(hive_get_time() + interval, interval, &timer);
+
+        // Hog the CPU (no yield) across several periods
+        uint64_t busy_until = hive_get_time() + 6 * interval + interval / 2;
+        while (hive_get_time() < busy_until) {
+        }
+
+        hive_message msg;
+        hive_status status = hive_ipc_recv_match(
+            HIVE_SENDER_ANY, HIVE_MSG_TIMER, timer, &msg, 500);
+        uint32_t missed = hive_timer_missed(&msg);
+
+        hive_message next;
+        hive_status status2 = hive_ipc_recv_match(
+            HIVE_SENDER_ANY, HIVE_MSG_TIMER, timer, &next, 500);
+        hive_timer_cancel(timer);
+
+        if (HIVE_SUCCEEDED(status) && missed >= 4 && HIVE_SUCCEEDED(status2)) {
+            TEST_PASS("one tick reports the missed periods");
+        } else {
+            printf("    missed=%u\n", missed);
+            TEST_FAIL("overrun not reported");
+        }
+    }
+
+    // ========================================================================
+    // Test 23: A lagging owner holds at most one tick per periodic timer
+    // ========================================================================
+    printf("\nTest 23: Pending periodic ticks are coalesced\n");
+    {
+        timer_id timer;
+        hive_timer_every(1000, &timer); // 1ms
+
+        // Other messages stay queued while sleeping; ticks must not pile up
+        hive_sleep(30000);
+        size_t queued = hive_ipc_count();
+
+        hive_message msg;
+        hive_status status = hive_ipc_recv_match(
+            HIVE_SENDER_ANY, HIVE_MSG_TIMER, timer, &msg, 500);
+        uint32_t missed = hive_timer_missed(&msg);
+
+        hive_timer_stats stats;
+        hive_timer_get_stats(timer, &stats);
+
+        // Once received, the next expiration queues a fresh tick
+        hive_message next;
+        hive_status status2 = hive_ipc_recv_match(
+            HIVE_SENDER_ANY, HIVE_MSG_TIMER, timer, &next, 500);
+        hive_timer_cancel(timer);
+
+        if (queued == 1 && HIVE_SUCCEEDED(status) && missed >= 20) {
+            TEST_PASS("one queued tick reports every folded expiration");
+        } else {
+            printf("    queued=%zu missed=%u\n", queued, missed);
+            TEST_FAIL("periodic ticks flooded the mailbox");
+        }
+        if (stats.ticks == 1 && stats.missed == missed &&
+            HIVE_SUCCEEDED(status2)) {
+            TEST_PASS("stats count folded expirations as missed");
+        } else {
+            TEST_FAIL("coalesced tick stats inconsistent");
+        }
+    }
+
+    // ========================================================================
+    // Test 24: Slack timer joins a later timer's wakeup
+    // ========================================================================
+    printf("\nTest 24: Timer slack batches wakeups\n");
+    {
+        uint64_t start = time_ms();
+        timer_id fixed, loose;
+        hive_timer_after(20000, &fixed);              // 20ms, exact
+        hive_timer_after_slack(10000, 20000, &loose); // 10-30ms
+
+        hive_message msg;
+        hive_status status = hive_ipc_recv_match(
+            HIVE_SENDER_ANY, HIVE_MSG_TIMER, loose, &msg, 500);
+        uint64_t elapsed = time_ms() - start;
+
+        // The exact timer must already be queued: both fired in one batch
+        hive_status batched = hive_ipc_recv_match(
+            HIVE_SENDER_ANY, HIVE_MSG_TIMER, fixed, &msg, 0);
+
+        if (HIVE_SUCCEEDED(status) && elapsed >= 10 &&
+            HIVE_SUCCEEDED(batched)) {
+            TEST_PASS("slack timer fired with the 20ms timer");
+        } else {
+            printf("    elapsed=%lums batched=%d\n", (unsigned long)elapsed,
+                   HIVE_SUCCEEDED(batched));
+            TEST_FAIL("slack timer not batched");
+            hive_timer_cancel(fixed);
+        }
+
+        if (hive_timer_after_slack(1000, 1000, NULL).code == HIVE_ERR_INVALID) {
+            TEST_PASS("NULL out pointer rejected");
+        } else {
+            TEST_FAIL("NULL out pointer accepted");
+        }
+    }
+
+    // ========================================================================
+    // Test 25: Spin-wait tail for short sleeps
+    // ========================================================================
+    printf("\nTest 25: Spin-wait tail for short sleeps\n");
+    {
+        hive_timer_set_spin(500);
+
+        // Median of 21 short sleeps: a few may still be preempted
+        uint64_t late_us[21];
+        bool early = false;
+        for (int i = 0; i < 21; i++) {
+            uint64_t start = hive_get_time();
+            hive_sleep(300);
+            uint64_t elapsed = hive_get_time() - start;
+            early = early || elapsed < 300;
+            late_us[i] = elapsed < 300 ? 0 : elapsed - 300;
+        }
+        hive_timer_set_spin(0);
+
+        for (int i = 1; i < 21; i++) {
+            for (int j = i; j > 0 && late_us[j] < late_us[j - 1]; j--) {
+                uint64_t tmp = late_us[j];
+                late_us[j] = late_us[j - 1];
+                late_us[j - 1] = tmp;
+            }
+        }
+
+        if (!early) {
+            TEST_PASS("spinning never wakes before the deadline");
+        } else {
+            TEST_FAIL("woke before the deadline");
+        }
+
+#ifdef HIVE_PLATFORM_LINUX
+        if (late_us[10] < 50) {
+            TEST_PASS("median wake error under 50us");
+        } else {
+            printf("    median late %luus\n", (unsigned long)late_us[10]);
+            TEST_FAIL("spin-wait not precise");
+        }
+#endif
+    }
+
     printf("\n=== Results ===\n");
     printf("Passed: %d\n", tests_passed);
     printf("Failed: %d\n", tests_failed);
@@ -0,0 +1,299 @@
+#include "hive_timer_wheel.h"
+#include <stdio.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+// Unit tests for the hierarchical timer wheel behind the STM32 timer
+// backend. The wheel is plain data structure code, so it runs on the host
+// and in QEMU without the runtime.
+
+// Test results
+static int tests_passed = 0;
+static int tests_failed = 0;
+
+#define TEST_PASS(name)               \
+    do {                              \
+        printf("  PASS: %s\n", name); \
+        fflush(stdout);               \
+        tests_passed++;               \
+    } while (0)
+#define TEST_FAIL(name)               \
+    do {                              \
+        printf("  FAIL: %s\n", name); \
+        fflush(stdout);               \
+        tests_failed++;               \
+    } while (0)
+
+static hive_timer_wheel s_wheel;
+
+// Advance to 'now' and count the nodes that expired
+static int advance_count(uint32_t now) {
+    hive_timer_wheel_advance(&s_wheel, now);
+    int n = 0;
+    while (hive_timer_wheel_pop(&s_wheel)) {
+        n++;
+    }
+    return n;
+}
+
+// ============================================================================
+// Test 1: Nodes fire exactly at their expiry on every level
+// ============================================================================
+
+static void test1_exact_expiry(void) {
+    printf("\nTest 1: Nodes fire exactly at their expiry on every level\n");
+
+    static const uint32_t delays[] = {
+        1, 2, 31, 32, 33, 1000, 1024, 1025, 40000, 1048583, 1073741829u};
+    bool ok = true;
+    for (size_t i = 0; i < sizeof(delays) / sizeof(delays[0]); i++) {
+        hive_timer_wheel_node node;
+        uint32_t start = 12345;
+        hive_timer_wheel_init(&s_wheel, start);
+        hive_timer_wheel_insert(&s_wheel, &node, start + delays[i]);
+
+        int early = advance_count(start + delays[i] - 1);
+        int on_time = advance_count(start + delays[i]);
+        if (early != 0 || on_time != 1) {
+            printf("    delay %lu: %d early, %d on time\n",
+                   (unsigned long)delays[i], early, on_time);
+            ok = false;
+        }
+    }
+    if (ok) {
+        TEST_PASS("one-tick to 2^30-tick delays fire on their tick");
+    } else {
+        TEST_FAIL("expiry off by at least one tick");
+    }
+}
+
+// ============================================================================
+// Test 2: next() never overshoots and an event loop lands on the expiry
+// ============================================================================
+
+static void test2_next_event(void) {
+    printf("\nTest 2: next() never overshoots the earliest expiry\n");
+
+    hive_timer_wheel_node node;
+    hive_timer_wheel_init(&s_wheel, 0);
+    uint32_t tick;
+    if (!hive_timer_wheel_next(&s_wheel, &tick)) {
+        TEST_PASS("empty wheel has no next event");
+    } else {
+        TEST_FAIL("empty wheel reported an event");
+    }
+
+    // Jump from event to event the way a tickless idle loop does
+    uint32_t expiry = 5000000;
+    hive_timer_wheel_insert(&s_wheel, &node, expiry);
+    int wakeups = 0;
+    int fired = 0;
+    bool overshoot = false;
+    while (hive_timer_wheel_next(&s_wheel, &tick) && wakeups < 100) {
+        if ((int32_t)(tick - expiry) > 0) {
+            overshoot = true;
+        }
+        fired += advance_count(tick);
+        wakeups++;
+    }
+    if (!overshoot && fired == 1 && s_wheel.now == expiry &&
+        wakeups < HIVE_TIMER_WHEEL_LEVELS) {
+        TEST_PASS("5M-tick timer reached in fewer wakeups than levels");
+    } else {
+        printf("    now %lu, %d wakeups, fired %d\n",
+               (unsigned long)s_wheel.now, wakeups, fired);
+        TEST_FAIL("event loop missed the expiry");
+    }
+
+    hive_timer_wheel_insert(&s_wheel, &node, s_wheel.now + 7);
+    if (hive_timer_wheel_next(&s_wheel, &tick) && tick == s_wheel.now + 7) {
+        TEST_PASS("level-0 next event is the exact expiry");
+    } else {
+        TEST_FAIL("level-0 next event");
+    }
+}
+
+// ============================================================================
+// Test 3: Remove from a slot and from the expired list
+// ============================================================================
+
+static void test3_remove(void) {
+    printf("\nTest 3: Remove from a slot and from the expired list\n");
+
+    hive_timer_wheel_node a, b, c;
+    uint32_t tick;
+    hive_timer_wheel_init(&s_wheel, 100);
+    hive_timer_wheel_insert(&s_wheel, &a, 110);
+    hive_timer_wheel_insert(&s_wheel, &b, 110);
+    hive_timer_wheel_insert(&s_wheel, &c, 5000);
+    hive_timer_wheel_remove(&s_wheel, &b);
+    hive_timer_wheel_remove(&s_wheel, &c);
+
+    hive_timer_wheel_advance(&s_wheel, 200);
+    hive_timer_wheel_node *first = hive_timer_wheel_pop(&s_wheel);
+    hive_timer_wheel_node *second = hive_timer_wheel_pop(&s_wheel);
+    if (first == &a && !second) {
+        TEST_PASS("removed nodes never fire");
+    } else {
+        TEST_FAIL("removed node fired");
+    }
+
+    hive_timer_wheel_insert(&s_wheel, &a, 210);
+    hive_timer_wheel_advance(&s_wheel, 300);
+    hive_timer_wheel_remove(&s_wheel, &a); // Expired, not yet popped
+    if (!hive_timer_wheel_pop(&s_wheel) &&
+        !hive_timer_wheel_next(&s_wheel, &tick)) {
+        TEST_PASS("remove from the expired list leaves the wheel empty");
+    } else {
+        TEST_FAIL("expired-list remove");
+    }
+}
+
+// ============================================================================
+// Test 4: Past expiries and counter wrap-around
+// ============================================================================
+
+static void test4_past_and_wrap(void) {
+    printf("\nTest 4: Past expiries and counter wrap-around\n");
+
+    hive_timer_wheel_node a, b;
+    hive_timer_wheel_init(&s_wheel, 1000);
+    bool due = hive_timer_wheel_insert(&s_wheel, &a, 900);
+    if (due && hive_timer_wheel_pop(&s_wheel) == &a) {
+        TEST_PASS("expiry in the past is due at once");
+    } else {
+        TEST_FAIL("expiry in the past");
+    }
+
+    uint32_t start = 0xFFFFFF00u;
+    hive_timer_wheel_init(&s_wheel, start);
+    hive_timer_wheel_insert(&s_wheel, &a, start + 0x80);  // Before the wrap
+    hive_timer_wheel_insert(&s_wheel, &b, start + 0x900); // After it
+    int before = advance_count(start + 0x7F);
+    int first = advance_count(start + 0x80);
+    int middle = advance_count(start + 0x8FF);
+    int second = advance_count(start + 0x900);
+    if (before == 0 && first == 1 && middle == 0 && second == 1) {
+        TEST_PASS("timers across the 32-bit wrap fire on their tick");
+    } else {
+        TEST_FAIL("wrap-around");
+    }
+}
+
+// ============================================================================
+// Test 5: Randomized against a reference model
+// ============================================================================
+
+#define RANDOM_NODES 48
+#define RANDOM_STEPS 20000
+
+static uint32_t s_rng = 0x2545F491u;
+
+static uint32_t rng(void) {
+    s_rng ^= s_rng << 13;
+    s_rng ^= s_rng >> 17;
+    s_rng ^= s_rng << 5;
+    return s_rng;
+}
+
+// Mostly short delays, some spanning the higher levels
+static uint32_t random_delay(void) {
+    switch (rng() % 4) {
+    case 0:
+        return rng() % 40;
+    case 1:
+        return rng() % 2000;
+    case 2:
+        return rng() % 100000;
+    default:
+        return rng() % (1u << 24);
+    }
+}
+
+static void test5_random(void) {
+    printf("\nTest 5: Randomized against a reference model\n");
+
+    static hive_timer_wheel_node nodes[RANDOM_NODES];
+    static bool active[RANDOM_NODES];
+    uint32_t now = 0xFFF00000u; // Wraps during the run
+    hive_timer_wheel_init(&s_wheel, now);
+    for (size_t i = 0; i < RANDOM_NODES; i++) {
+        active[i] = false;
+    }
+
+    int errors = 0;
+    int fired = 0;
+    for (int step = 0; step < RANDOM_STEPS && errors < 5; step++) {
+        size_t i = rng() % RANDOM_NODES;
+        uint32_t op = rng() % 8;
+        if (op < 4 && !active[i]) {
+            hive_timer_wheel_insert(&s_wheel, &nodes[i], now + random_delay());
+            active[i] = true;
+        } else if (op == 4 && active[i]) {
+            hive_timer_wheel_remove(&s_wheel, &nodes[i]);
+            active[i] = false;
+        } else {
+            // Step time: a few ticks, or straight to the next event
+            uint32_t prev = now;
+            uint32_t tick;
+            if (op == 7 && hive_timer_wheel_next(&s_wheel, &tick)) {
+                now = tick;
+            } else {
+                now += rng() % 300;
+            }
+            hive_timer_wheel_advance(&s_wheel, now);
+
+            hive_timer_wheel_node *node;
+            while ((node = hive_timer_wheel_pop(&s_wheel))) {
+                size_t idx = (size_t)(node - nodes);
+                int32_t late = (int32_t)(now - node->expiry);
+                if (!active[idx] || late < 0 ||
+                    (uint32_t)late > now - prev) {
+                    printf("    node %zu expiry %lu fired at %lu\n", idx,
+                           (unsigned long)node->expiry, (unsigned long)now);
+                    errors++;
+                }
+                active[idx] = false;
+                fired++;
+            }
+            for (size_t j = 0; j < RANDOM_NODES; j++) {
+                if (active[j] && (int32_t)(nodes[j].expiry - now) <= 0) {
+                    printf("    node %zu expiry %lu missed at %lu\n", j,
+                           (unsigned long)nodes[j].expiry,
+                           (unsigned long)now);
+                    errors++;
+                    active[j] = false;
+                }
+            }
+        }
+    }
+
+    if (errors == 0 && fired > 1000) {
+        TEST_PASS("every node fired in the step that crossed its expiry");
+    } else {
+        printf("    %d errors, %d fired\n", errors, fired);
+        TEST_FAIL("wheel diverged from the reference model");
+    }
+}
+
+// ============================================================================
+// Test runner
+// ============================================================================
+
+int main(void) {
+    printf("=== Timer Wheel Test Suite ===\n");
+
+    test1_exact_expiry();
+    test2_next_event();
+    test3_remove();
+    test4_past_and_wrap();
+    test5_random();
+
+    printf("\n=== Results ===\n");
+    printf("Passed: %d\n", tests_passed);
+    printf("Failed: %d\n", tests_failed);
+    printf("\n%s\n",
+           tests_failed == 0 ? "All tests passed!" : "Some tests FAILED!");
+
+    return tests_failed > 0 ? 1 : 0;
+}